@@ -4,7 +4,7 @@
 using namespace Opportunity::ChakraBridge::WinRT;
 
 JsContext::JsContext(const RawContext ref, JsRuntime^const runtime)
-    :Reference(std::move(ref)), Rt(runtime)
+    :Reference(std::move(ref)), Primitives(Intrinsics), Rt(runtime)
 {
     _ASSERTE(runtime != nullptr);
     _ASSERTE(Reference.IsValid());
@@ -23,6 +23,10 @@ void JsContext::PreDestory()
 {
     if (!Reference.IsValid())
         return;
+    Wrappers.Clear();
+    Primitives.Clear();
+    Helpers.Clear();
+    Intrinsics.Clear();
     Reference = nullptr;
     Rt = nullptr;
 }
@@ -36,8 +40,11 @@ JsContext::~JsContext()
         // has been set to invalid by JsRuntime::~JsRuntime
         return;
     if (RawContext::Current() == Reference)
-        RawContext::Current(nullptr);
+        ResetCurrent();
     Rt->Contexts.erase(Reference);
+    Primitives.Clear();
+    Helpers.Release();
+    Intrinsics.Release();
     Reference.Release();
     PreDestory();
 }
@@ -49,6 +56,18 @@ JsRuntime^ JsContext::Runtime::get()
     return Rt;
 }
 
+bool JsContext::WrapperCacheEnabled::get()
+{
+    ThrowIfDestoried();
+    return Wrappers.Enabled;
+}
+
+void JsContext::WrapperCacheEnabled::set(bool value)
+{
+    ThrowIfDestoried();
+    Wrappers.SetEnabled(value);
+}
+
 /// <summary>
 /// Use the context in the following scope.
 /// </summary>
@@ -43,7 +43,7 @@ IJsFunction^ JsContext::ParseScript(string^ script, IBuffer^ buffer, string^ sou
 {
     const auto pointer = GetPointerOfBuffer(buffer);
     const auto r = RawContext::ParseScript(script->Data(), pointer, SourceContext++, sourceName->Data());
-    return ref new JsFunctionImpl(r);
+    return JsWrapperCache::Wrap<JsFunctionImpl>(r);
 }
 
 IJsValue^ JsContext::RunScript(string^ script, IBuffer^ buffer, string^ sourceName)
@@ -58,7 +58,7 @@ IJsFunction^ JsContext::ParseScript(string^ script, string^ sourceName)
 {
     NULL_CHECK(script);
     const auto r = RawContext::ParseScript(script->Data(), SourceContext++, sourceName->Data());
-    return ref new JsFunctionImpl(r);
+    return JsWrapperCache::Wrap<JsFunctionImpl>(r);
 }
 
 IJsValue^ JsContext::RunScript(string^ script, string^ sourceName)
@@ -110,7 +110,7 @@ IJsFunction^ JsContext::ParseScript(Opportunity::ChakraBridge::WinRT::JsSerializ
     const auto pointer = GetPointerOfBuffer(buffer);
     LoadSource[SourceContext] = scriptLoadCallback;
     const auto r = RawContext::ParseScript(JsSerializedScriptLoadSourceCallbackImpl, JsSerializedScriptUnloadCallbackImpl, pointer, SourceContext++, sourceUrl->Data());
-    return ref new JsFunctionImpl(r);
+    return JsWrapperCache::Wrap<JsFunctionImpl>(r);
 }
 
 IJsValue^ JsContext::RunScript(Opportunity::ChakraBridge::WinRT::JsSerializedScriptLoadSourceCallback^ scriptLoadCallback, IBuffer^ buffer, string^ sourceUrl)
@@ -62,6 +62,44 @@ void JsContext::ProjectWinRTNamespace(string^ namespaceName)
     RawContext::ProjectWinRTNamespace(namespaceName->Data());
 }
 
+// Keep the current context and its runtime alive while they are current on this thread,
+// since the thread local caches point into them and the finalizer may run on other threads.
+struct CurrentRefs
+{
+    JsContext^ Context = nullptr;
+    JsRuntime^ Runtime = nullptr;
+
+    void Reset()
+    {
+        RawContext::Current(nullptr);
+        RawPropertyIdTable::Current = nullptr;
+        RawStorageGeneration::Current = nullptr;
+        RawIntrinsicValues::Current = nullptr;
+        RawHelperFunctions::Current = nullptr;
+        JsPrimitiveCache::Current = nullptr;
+        JsWrapperCache::Current = nullptr;
+        // take the refs out before releasing them, the destructors may reset again.
+        // locals are released in reverse order, the context goes first.
+        const auto runtime = Runtime;
+        const auto context = Context;
+        Context = nullptr;
+        Runtime = nullptr;
+    }
+
+    ~CurrentRefs()
+    {
+        if (Context != nullptr)
+            Reset();
+    }
+};
+
+static thread_local CurrentRefs CurrentThreadRefs;
+
+void JsContext::ResetCurrent()
+{
+    CurrentThreadRefs.Reset();
+}
+
 JsContext^ JsContext::Current::get()
 {
     return Get(RawContext::Current());
@@ -70,12 +108,22 @@ JsContext^ JsContext::Current::get()
 void JsContext::Current::set(JsContext^ value)
 {
     if (value == nullptr)
-        RawContext::Current(nullptr);
+    {
+        ResetCurrent();
+    }
     else
     {
         value->ThrowIfDestoried();
         const auto ref = value->Reference;
         RawContext::Current(ref);
+        RawPropertyIdTable::Current = &value->Rt->PropertyIds;
+        RawStorageGeneration::Current = &value->Rt->StorageGeneration;
+        RawIntrinsicValues::Current = &value->Intrinsics;
+        RawHelperFunctions::Current = &value->Helpers;
+        JsPrimitiveCache::Current = &value->Primitives;
+        JsWrapperCache::Current = &value->Wrappers;
+        CurrentThreadRefs.Context = value;
+        CurrentThreadRefs.Runtime = value->Rt;
         RawContext::SetPromiseContinuationCallback<RawContext, JsPromiseContinuationCallbackImpl>(ref);
     }
     LastJsError = nullptr;
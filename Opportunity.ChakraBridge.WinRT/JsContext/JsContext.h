@@ -5,6 +5,8 @@
 #include "JsContextScope.h"
 #include "Value\JsError.h"
 #include "Value\JsFunction.h"
+#include "Value\JsPrimitiveCache.h"
+#include "Value\JsWrapperCache.h"
 #include <queue>
 
 namespace Opportunity::ChakraBridge::WinRT
@@ -37,6 +39,10 @@ namespace Opportunity::ChakraBridge::WinRT
 #pragma region Instance
     internal:
         RawContext Reference;
+        RawIntrinsicValues Intrinsics;
+        RawHelperFunctions Helpers;
+        JsPrimitiveCache Primitives;
+        JsWrapperCache Wrappers;
         JsRuntime^ Rt;
         JsContext(const RawContext ref, JsRuntime^const runtime);
         void PreDestory();
@@ -49,6 +55,20 @@ namespace Opportunity::ChakraBridge::WinRT
         /// </summary>
         DECL_R_PROPERTY(JsRuntime^, Runtime);
 
+        /// <summary>
+        /// Gets or sets a value indicating whether objects crossing into native code reuse their wrappers in the context.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Disabled by default. When enabled, the same object gets the same wrapper while the wrapper is alive,
+        /// and a before-collect callback is set on each object that gets a wrapper.
+        /// </para>
+        /// <para>
+        /// Wrappers are dropped from the context when disabled.
+        /// </para>
+        /// </remarks>
+        DECL_RW_PROPERTY(bool, WrapperCacheEnabled);
+
         JsContextScope^ Use(bool disposeContext);
 
 #pragma endregion
@@ -58,6 +78,8 @@ namespace Opportunity::ChakraBridge::WinRT
         static JsContext^ Get(const RawContext& reference);
         static RawValue LastJsError;
         static void GetAndClearExceptionCore();
+        // Clears the current context of this thread and releases the context and its runtime.
+        static void ResetCurrent();
 
     public:
         /// <summary>
@@ -58,13 +58,17 @@ JsRuntime::~JsRuntime()
         RuntimeDictionary.erase(Handle);
     }
 
+    // ids are released before the current context is reset.
+    PropertyIds.Release();
     const auto cc = RawContext::Current();
     if (cc.IsValid())
     {
         RawRuntime cr = cc.Runtime();
         if (cr == Handle)
-            RawContext::Current(nullptr);
+            JsContext::ResetCurrent();
     }
+    if (RawStorageGeneration::Current == &StorageGeneration)
+        RawStorageGeneration::Current = nullptr;
     Handle.Dispose();
     std::for_each(this->Contexts.begin(), this->Contexts.end(), [](auto& item)
     {
@@ -80,14 +84,54 @@ void JsRuntime::CollectGarbage()
     Handle.CollectGarbage();
 }
 
+/// <summary>
+/// Get the instance of the <see cref="JsRuntime"/>, or <see langword="null"/>, if it has been disposed.
+/// </summary>
+/// <param name="handle">The handle of the runtime.</param>
+/// <returns>The instance of the <see cref="JsRuntime"/></returns>
+JsRuntime^ JsRuntime::Get(const RawRuntime& handle)
+{
+    std::lock_guard<std::mutex> lock(mx);
+    const auto entry = RuntimeDictionary.find(handle);
+    if (entry == RuntimeDictionary.end())
+        return nullptr;
+    return entry->second.Resolve<JsRuntime>();
+}
+
 JsContext^ JsRuntime::CreateContext()
 {
     const auto ref = RawContext(Handle);
     auto context = ref new JsContext(ref, this);
     Contexts[ref] = context;
+    InitContext(context);
     return context;
 }
 
+void JsRuntime::InitContext(JsContext^ context)
+{
+    // sets the previous context back on leaving, also when resolving throws.
+    struct PreviousContext
+    {
+        const RawContext Context = RawContext::Current();
+        // ignore error.
+        ~PreviousContext() { JsSetCurrentContext(Context.Ref); }
+    } previous;
+    RawContext::Current(context->Reference);
+    try
+    {
+        context->Intrinsics.Resolve();
+        context->Helpers.Resolve();
+        if (!PropertyIds.HasKeys())
+            PropertyIds.ResolveKeys();
+    }
+    catch (Platform::Exception^ ex)
+    {
+        // the engine refuses calls in exception or disabled state, unresolved values will be got from the engine on use.
+        if (ex->HResult != E_ILLEGAL_METHOD_CALL)
+            throw;
+    }
+}
+
 JsRuntime^ JsRuntime::Create(JsRA attributes)
 {
     return ref new JsRuntime(RawRuntime(attributes, JsThreadServiceCallbackImpl));
@@ -84,12 +84,16 @@ namespace Opportunity::ChakraBridge::WinRT
         const std::unique_ptr<RW> Ptr;
         static void BeforeCollectCallback(const RWP&callbackState);
         static bool MemoryAllocationCallback(const RWP&callbackState, const JsMEType allocationEvent, const size_t allocationSize);
+        void InitContext(JsContext^ context);
 
     internal:
         const RawRuntime Handle;
         JsRuntime(RawRuntime handle);
         std::unordered_map<RawContext, weak_ref> Contexts;
+        RawPropertyIdTable PropertyIds;
+        RawStorageGeneration StorageGeneration;
         static std::unordered_map<RawRuntime, weak_ref> RuntimeDictionary;
+        static JsRuntime^ Get(const RawRuntime& handle);
 
         static bool CALLBACK JsThreadServiceCallbackImpl(_In_ JsBackgroundWorkItemCallback callback, _In_opt_ void *callbackState);
 
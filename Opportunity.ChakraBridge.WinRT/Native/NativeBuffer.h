@@ -45,7 +45,16 @@ namespace Opportunity::ChakraBridge::WinRT
             if (data == nullptr)
                 return RPC_E_DISCONNECTED;
 
-            *value = data->BufferPtr;
+            try
+            {
+                // storage is fetched again if it may have been detached, without a current context
+                // the storage fetched in RuntimeClassInitialize or later is used.
+                *value = data->BufferPtr;
+            }
+            catch (Platform::Exception^ ex)
+            {
+                return ex->HResult;
+            }
             return S_OK;
         }
 
@@ -55,7 +64,14 @@ namespace Opportunity::ChakraBridge::WinRT
             if (data == nullptr)
                 return RPC_E_DISCONNECTED;
 
-            *value = data->BufferLen;
+            try
+            {
+                *value = data->BufferLen;
+            }
+            catch (Platform::Exception^ ex)
+            {
+                return ex->HResult;
+            }
             return S_OK;
         }
 
@@ -75,8 +91,15 @@ namespace Opportunity::ChakraBridge::WinRT
             if (data == nullptr)
                 return RPC_E_DISCONNECTED;
 
-            if (data->BufferLen < value)
-                return E_INVALIDARG;
+            try
+            {
+                if (data->BufferLen < value)
+                    return E_INVALIDARG;
+            }
+            catch (Platform::Exception^ ex)
+            {
+                return ex->HResult;
+            }
 
             m_length = value;
             return S_OK;
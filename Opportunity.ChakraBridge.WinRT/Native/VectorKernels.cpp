@@ -0,0 +1,566 @@
+#include "pch.h"
+#include "VectorKernels.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#define VECTOR_KERNELS_X86
+#endif
+
+using namespace Opportunity::ChakraBridge::WinRT;
+
+#ifdef VECTOR_KERNELS_X86
+
+// SSE2 is required by all supported versions of windows on x86 and x64, AVX2 is detected on first use.
+static bool HasAvx2()
+{
+    static const bool value = []()
+    {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+        __cpuid(info, 1);
+        const auto osxsave = (info[2] & (1 << 27)) != 0;
+        const auto avx = (info[2] & (1 << 28)) != 0;
+        // ymm state must be enabled by the os.
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }();
+    return value;
+}
+
+static size_t FirstLane(const unsigned long byteMask, const size_t laneSize)
+{
+    unsigned long bit;
+    _BitScanForward(&bit, byteMask);
+    return bit / laneSize;
+}
+
+template<typename T>
+static __m128i Sse2Splat(const T value)
+{
+    if constexpr (std::is_same_v<T, float32>)
+        return _mm_castps_si128(_mm_set1_ps(value));
+    else if constexpr (std::is_same_v<T, float64>)
+        return _mm_castpd_si128(_mm_set1_pd(value));
+    else if constexpr (sizeof(T) == 1)
+        return _mm_set1_epi8(static_cast<char>(value));
+    else if constexpr (sizeof(T) == 2)
+        return _mm_set1_epi16(static_cast<short>(value));
+    else
+        return _mm_set1_epi32(static_cast<int>(value));
+}
+
+// Lanes of equal elements are set to all ones, floating points are compared as numbers.
+template<typename T>
+static __m128i Sse2Equal(const __m128i a, const __m128i b)
+{
+    if constexpr (std::is_same_v<T, float32>)
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    else if constexpr (std::is_same_v<T, float64>)
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    else if constexpr (sizeof(T) == 1)
+        return _mm_cmpeq_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm_cmpeq_epi16(a, b);
+    else
+        return _mm_cmpeq_epi32(a, b);
+}
+
+template<typename T>
+static __m256i Avx2Splat(const T value)
+{
+    if constexpr (std::is_same_v<T, float32>)
+        return _mm256_castps_si256(_mm256_set1_ps(value));
+    else if constexpr (std::is_same_v<T, float64>)
+        return _mm256_castpd_si256(_mm256_set1_pd(value));
+    else if constexpr (sizeof(T) == 1)
+        return _mm256_set1_epi8(static_cast<char>(value));
+    else if constexpr (sizeof(T) == 2)
+        return _mm256_set1_epi16(static_cast<short>(value));
+    else
+        return _mm256_set1_epi32(static_cast<int>(value));
+}
+
+template<typename T>
+static __m256i Avx2Equal(const __m256i a, const __m256i b)
+{
+    if constexpr (std::is_same_v<T, float32>)
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    else if constexpr (std::is_same_v<T, float64>)
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    else if constexpr (sizeof(T) == 1)
+        return _mm256_cmpeq_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm256_cmpeq_epi16(a, b);
+    else
+        return _mm256_cmpeq_epi32(a, b);
+}
+
+template<typename T>
+static size_t FindSse2(const T* data, const size_t count, const T value)
+{
+    constexpr size_t lanes = sizeof(__m128i) / sizeof(T);
+    const auto needle = Sse2Splat(value);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto mask = static_cast<unsigned long>(_mm_movemask_epi8(Sse2Equal<T>(block, needle)));
+        if (mask != 0)
+            return i + FirstLane(mask, sizeof(T));
+    }
+    return i + static_cast<size_t>(std::find(data + i, data + count, value) - (data + i));
+}
+
+template<typename T>
+static size_t FindAvx2(const T* data, const size_t count, const T value)
+{
+    constexpr size_t lanes = sizeof(__m256i) / sizeof(T);
+    const auto needle = Avx2Splat(value);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = static_cast<unsigned long>(static_cast<unsigned int>(_mm256_movemask_epi8(Avx2Equal<T>(block, needle))));
+        if (mask != 0)
+            return i + FirstLane(mask, sizeof(T));
+    }
+    _mm256_zeroupper();
+    return i + FindSse2(data + i, count - i, value);
+}
+
+template<typename T>
+static size_t FindVector(const T* data, const size_t count, const T value)
+{
+    if (HasAvx2())
+        return FindAvx2(data, count, value);
+    return FindSse2(data, count, value);
+}
+
+#define FIND_ELEMENT(type) \
+template<> size_t Opportunity::ChakraBridge::WinRT::FindElement<type>(const type* data, const size_t count, const type value) \
+{ return FindVector(data, count, value); }
+
+#else // VECTOR_KERNELS_X86
+
+#define FIND_ELEMENT(type) \
+template<> size_t Opportunity::ChakraBridge::WinRT::FindElement<type>(const type* data, const size_t count, const type value) \
+{ return static_cast<size_t>(std::find(data, data + count, value) - data); }
+
+#endif // VECTOR_KERNELS_X86
+
+FIND_ELEMENT(int8)
+FIND_ELEMENT(uint8)
+FIND_ELEMENT(int16)
+FIND_ELEMENT(uint16)
+FIND_ELEMENT(int32)
+FIND_ELEMENT(uint32)
+FIND_ELEMENT(float32)
+FIND_ELEMENT(float64)
+
+#undef FIND_ELEMENT
+
+template<>
+void Opportunity::ChakraBridge::WinRT::WidenElements<int8, int16>(const int8* src, const size_t count, int16* dst)
+{
+    size_t i = 0;
+#ifdef VECTOR_KERNELS_X86
+    if (HasAvx2())
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepi8_epi16(block));
+        }
+        _mm256_zeroupper();
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // duplicates each byte to both halves of a word, then shifts the sign into the high half.
+        const auto lo = _mm_srai_epi16(_mm_unpacklo_epi8(block, block), 8);
+        const auto hi = _mm_srai_epi16(_mm_unpackhi_epi8(block, block), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), hi);
+    }
+#endif
+    std::copy(src + i, src + count, dst + i);
+}
+
+template<>
+bool Opportunity::ChakraBridge::WinRT::ElementsInRange<int8, int16>(const int16* src, const size_t count)
+{
+    size_t i = 0;
+#ifdef VECTOR_KERNELS_X86
+    if (HasAvx2())
+    {
+        const auto max = _mm256_set1_epi16(std::numeric_limits<int8>::max());
+        const auto min = _mm256_set1_epi16(std::numeric_limits<int8>::min());
+        auto outOfRange = _mm256_setzero_si256();
+        for (; i + 16 <= count; i += 16)
+        {
+            const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            outOfRange = _mm256_or_si256(outOfRange, _mm256_or_si256(_mm256_cmpgt_epi16(block, max), _mm256_cmpgt_epi16(min, block)));
+        }
+        const auto any = _mm256_movemask_epi8(outOfRange) != 0;
+        _mm256_zeroupper();
+        if (any)
+            return false;
+    }
+    {
+        const auto max = _mm_set1_epi16(std::numeric_limits<int8>::max());
+        const auto min = _mm_set1_epi16(std::numeric_limits<int8>::min());
+        auto outOfRange = _mm_setzero_si128();
+        for (; i + 8 <= count; i += 8)
+        {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            outOfRange = _mm_or_si128(outOfRange, _mm_or_si128(_mm_cmpgt_epi16(block, max), _mm_cmplt_epi16(block, min)));
+        }
+        if (_mm_movemask_epi8(outOfRange) != 0)
+            return false;
+    }
+#endif
+    return std::all_of(src + i, src + count, [](const int16 value)
+    {
+        return value <= std::numeric_limits<int8>::max() && value >= std::numeric_limits<int8>::min();
+    });
+}
+
+template<>
+void Opportunity::ChakraBridge::WinRT::NarrowElements<int16, int8>(const int16* src, const size_t count, int8* dst)
+{
+    size_t i = 0;
+#ifdef VECTOR_KERNELS_X86
+    if (HasAvx2())
+    {
+        for (; i + 32 <= count; i += 32)
+        {
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16));
+            // packs works on 128-bit lanes, restores the order of 64-bit quarters.
+            const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+        }
+        _mm256_zeroupper();
+    }
+    for (; i + 16 <= count; i += 16)
+    {
+        const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(a, b));
+    }
+#endif
+    std::transform(src + i, src + count, dst + i, [](const int16 value) { return static_cast<int8>(value); });
+}
+
+template<>
+float64 Opportunity::ChakraBridge::WinRT::SumElements<int16>(const int16* data, const size_t count)
+{
+    size_t i = 0;
+    int64 sum = 0;
+#ifdef VECTOR_KERNELS_X86
+    // lanes of madd are at most 2 * 32768 in magnitude, int32 accumulators are flushed every FlushBlocks blocks.
+    constexpr size_t FlushBlocks = 16384;
+    if (HasAvx2())
+    {
+        const auto ones = _mm256_set1_epi16(1);
+        while (i + 16 <= count)
+        {
+            const auto end = i + std::min((count - i) / 16, FlushBlocks) * 16;
+            auto acc = _mm256_setzero_si256();
+            for (; i < end; i += 16)
+                acc = _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), ones));
+            int32 lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            for (const auto lane : lanes)
+                sum += lane;
+        }
+        _mm256_zeroupper();
+    }
+    {
+        const auto ones = _mm_set1_epi16(1);
+        while (i + 8 <= count)
+        {
+            const auto end = i + std::min((count - i) / 8, FlushBlocks) * 8;
+            auto acc = _mm_setzero_si128();
+            for (; i < end; i += 8)
+                acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), ones));
+            int32 lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            for (const auto lane : lanes)
+                sum += lane;
+        }
+    }
+#endif
+    return static_cast<float64>(sum) + SumElementsScalar(data + i, count - i);
+}
+
+template<>
+float64 Opportunity::ChakraBridge::WinRT::SumElements<float32>(const float32* data, const size_t count)
+{
+    size_t i = 0;
+    float64 sum = 0;
+#ifdef VECTOR_KERNELS_X86
+    // elements are widened to float64 before adding, as the scalar code does.
+    if (HasAvx2())
+    {
+        auto acc = _mm256_setzero_pd();
+        for (; i + 4 <= count; i += 4)
+            acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm_loadu_ps(data + i)));
+        float64 lanes[4];
+        _mm256_storeu_pd(lanes, acc);
+        for (const auto lane : lanes)
+            sum += lane;
+        _mm256_zeroupper();
+    }
+    {
+        auto acc = _mm_setzero_pd();
+        for (; i + 2 <= count; i += 2)
+            acc = _mm_add_pd(acc, _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i)))));
+        float64 lanes[2];
+        _mm_storeu_pd(lanes, acc);
+        for (const auto lane : lanes)
+            sum += lane;
+    }
+#endif
+    return sum + SumElementsScalar(data + i, count - i);
+}
+
+template<>
+float64 Opportunity::ChakraBridge::WinRT::SumElements<float64>(const float64* data, const size_t count)
+{
+    size_t i = 0;
+    float64 sum = 0;
+#ifdef VECTOR_KERNELS_X86
+    if (HasAvx2())
+    {
+        auto acc = _mm256_setzero_pd();
+        for (; i + 4 <= count; i += 4)
+            acc = _mm256_add_pd(acc, _mm256_loadu_pd(data + i));
+        float64 lanes[4];
+        _mm256_storeu_pd(lanes, acc);
+        for (const auto lane : lanes)
+            sum += lane;
+        _mm256_zeroupper();
+    }
+    {
+        auto acc = _mm_setzero_pd();
+        for (; i + 2 <= count; i += 2)
+            acc = _mm_add_pd(acc, _mm_loadu_pd(data + i));
+        float64 lanes[2];
+        _mm_storeu_pd(lanes, acc);
+        for (const auto lane : lanes)
+            sum += lane;
+    }
+#endif
+    return sum + SumElementsScalar(data + i, count - i);
+}
+
+#ifdef VECTOR_KERNELS_X86
+
+#define MIN_MAX_TRAITS(name, type, vec, lanes, load, store, splat, min, max)    \
+struct name                                                                     \
+{                                                                               \
+    using T = type;                                                             \
+    using V = vec;                                                              \
+    static constexpr size_t Lanes = lanes;                                      \
+    static V Load(const T* p) { return load; }                                  \
+    static void Store(T* p, const V v) { store; }                               \
+    static V Splat(const T v) { return splat; }                                 \
+    static V Min(const V a, const V b) { return min; }                          \
+    static V Max(const V a, const V b) { return max; }                          \
+}
+
+MIN_MAX_TRAITS(Sse2Uint8, uint8, __m128i, 16, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v), _mm_set1_epi8(static_cast<char>(v)), _mm_min_epu8(a, b), _mm_max_epu8(a, b));
+MIN_MAX_TRAITS(Sse2Int16, int16, __m128i, 8, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v), _mm_set1_epi16(v), _mm_min_epi16(a, b), _mm_max_epi16(a, b));
+MIN_MAX_TRAITS(Sse2Float32, float32, __m128, 4, _mm_loadu_ps(p),
+    _mm_storeu_ps(p, v), _mm_set1_ps(v), _mm_min_ps(a, b), _mm_max_ps(a, b));
+MIN_MAX_TRAITS(Sse2Float64, float64, __m128d, 2, _mm_loadu_pd(p),
+    _mm_storeu_pd(p, v), _mm_set1_pd(v), _mm_min_pd(a, b), _mm_max_pd(a, b));
+MIN_MAX_TRAITS(Avx2Uint8, uint8, __m256i, 32, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v), _mm256_set1_epi8(static_cast<char>(v)), _mm256_min_epu8(a, b), _mm256_max_epu8(a, b));
+MIN_MAX_TRAITS(Avx2Int16, int16, __m256i, 16, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v), _mm256_set1_epi16(v), _mm256_min_epi16(a, b), _mm256_max_epi16(a, b));
+MIN_MAX_TRAITS(Avx2Float32, float32, __m256, 8, _mm256_loadu_ps(p),
+    _mm256_storeu_ps(p, v), _mm256_set1_ps(v), _mm256_min_ps(a, b), _mm256_max_ps(a, b));
+MIN_MAX_TRAITS(Avx2Float64, float64, __m256d, 4, _mm256_loadu_pd(p),
+    _mm256_storeu_pd(p, v), _mm256_set1_pd(v), _mm256_min_pd(a, b), _mm256_max_pd(a, b));
+
+#undef MIN_MAX_TRAITS
+
+template<typename TVec>
+static void MinMaxBlocks(const typename TVec::T* data, size_t& i, const size_t count, typename TVec::T& min, typename TVec::T& max)
+{
+    auto vmin = TVec::Splat(min);
+    auto vmax = TVec::Splat(max);
+    for (; i + TVec::Lanes <= count; i += TVec::Lanes)
+    {
+        const auto block = TVec::Load(data + i);
+        // min and max of floating points return the second operand if any of them is NaN.
+        vmin = TVec::Min(block, vmin);
+        vmax = TVec::Max(block, vmax);
+    }
+    typename TVec::T lanes[TVec::Lanes];
+    TVec::Store(lanes, vmin);
+    for (const auto lane : lanes)
+        min = std::min(min, lane);
+    TVec::Store(lanes, vmax);
+    for (const auto lane : lanes)
+        max = std::max(max, lane);
+}
+
+template<typename TSse2, typename TAvx2>
+static bool MinMaxVector(const typename TSse2::T* data, const size_t count, typename TSse2::T* min, typename TSse2::T* max)
+{
+    typename TSse2::T mn, mx, tailMin, tailMax;
+    // gets initial values of an empty range.
+    MinMaxElementsScalar(data, 0, &mn, &mx);
+    size_t i = 0;
+    if (HasAvx2())
+    {
+        MinMaxBlocks<TAvx2>(data, i, count, mn, mx);
+        _mm256_zeroupper();
+    }
+    MinMaxBlocks<TSse2>(data, i, count, mn, mx);
+    MinMaxElementsScalar(data + i, count - i, &tailMin, &tailMax);
+    *min = std::min(mn, tailMin);
+    *max = std::max(mx, tailMax);
+    return count != 0 && !(*min > *max);
+}
+
+#define MIN_MAX_ELEMENTS(type, sse2, avx2) \
+template<> bool Opportunity::ChakraBridge::WinRT::MinMaxElements<type>(const type* data, const size_t count, type* min, type* max) \
+{ return MinMaxVector<sse2, avx2>(data, count, min, max); }
+
+#else // VECTOR_KERNELS_X86
+
+#define MIN_MAX_ELEMENTS(type, sse2, avx2) \
+template<> bool Opportunity::ChakraBridge::WinRT::MinMaxElements<type>(const type* data, const size_t count, type* min, type* max) \
+{ return MinMaxElementsScalar(data, count, min, max); }
+
+#endif // VECTOR_KERNELS_X86
+
+MIN_MAX_ELEMENTS(uint8, Sse2Uint8, Avx2Uint8)
+MIN_MAX_ELEMENTS(int16, Sse2Int16, Avx2Int16)
+MIN_MAX_ELEMENTS(float32, Sse2Float32, Avx2Float32)
+MIN_MAX_ELEMENTS(float64, Sse2Float64, Avx2Float64)
+
+#undef MIN_MAX_ELEMENTS
+
+static uint16 SwapBytes(const uint16 value) { return _byteswap_ushort(value); }
+static uint32 SwapBytes(const uint32 value) { return _byteswap_ulong(value); }
+static uint64 SwapBytes(const uint64 value) { return _byteswap_uint64(value); }
+
+template<typename T>
+static void GatherScalar(const uint8* src, const size_t stride, const size_t begin, const size_t count, const bool swapBytes, uint8* dst)
+{
+    for (size_t i = begin; i < count; i++)
+    {
+        T value;
+        std::memcpy(&value, src + i * stride, sizeof(T));
+        if constexpr (sizeof(T) > 1)
+        {
+            if (swapBytes)
+                value = SwapBytes(value);
+        }
+        std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+template<typename T>
+static void ScatterScalar(const uint8* src, const size_t count, const bool swapBytes, uint8* dst, const size_t stride)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        T value;
+        std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+        if constexpr (sizeof(T) > 1)
+        {
+            if (swapBytes)
+                value = SwapBytes(value);
+        }
+        std::memcpy(dst + i * stride, &value, sizeof(T));
+    }
+}
+
+#ifdef VECTOR_KERNELS_X86
+
+// Gathers blocks of 4 or 8 bytes elements with AVX2, returns count of elements copied.
+static size_t GatherAvx2(const uint8* src, const size_t stride, const size_t count, const size_t elementSize, const bool swapBytes, uint8* dst)
+{
+    // offsets of a block are int32.
+    if (stride > static_cast<size_t>(std::numeric_limits<int>::max() / 8))
+        return 0;
+    const auto s = static_cast<int>(stride);
+    size_t i = 0;
+    if (elementSize == 4)
+    {
+        const auto offsets = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+        const auto swap = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        for (; i + 8 <= count; i += 8)
+        {
+            auto block = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src + i * stride), offsets, 1);
+            if (swapBytes)
+                block = _mm256_shuffle_epi8(block, swap);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), block);
+        }
+    }
+    else if (elementSize == 8)
+    {
+        const auto offsets = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+        const auto swap = _mm256_setr_epi8(
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        for (; i + 4 <= count; i += 4)
+        {
+            auto block = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src + i * stride), offsets, 1);
+            if (swapBytes)
+                block = _mm256_shuffle_epi8(block, swap);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 8), block);
+        }
+    }
+    _mm256_zeroupper();
+    return i;
+}
+
+#endif // VECTOR_KERNELS_X86
+
+void Opportunity::ChakraBridge::WinRT::GatherElements(const uint8* src, const size_t stride, const size_t count, const size_t elementSize, const bool swapBytes, uint8* dst)
+{
+    size_t begin = 0;
+#ifdef VECTOR_KERNELS_X86
+    if (HasAvx2())
+        begin = GatherAvx2(src, stride, count, elementSize, swapBytes, dst);
+#endif
+    switch (elementSize)
+    {
+    case 1: return GatherScalar<uint8>(src, stride, begin, count, swapBytes, dst);
+    case 2: return GatherScalar<uint16>(src, stride, begin, count, swapBytes, dst);
+    case 4: return GatherScalar<uint32>(src, stride, begin, count, swapBytes, dst);
+    case 8: return GatherScalar<uint64>(src, stride, begin, count, swapBytes, dst);
+    }
+    Throw(E_INVALIDARG, L"elementSize should be 1, 2, 4 or 8.");
+}
+
+void Opportunity::ChakraBridge::WinRT::ScatterElements(const uint8* src, const size_t count, const size_t elementSize, const bool swapBytes, uint8* dst, const size_t stride)
+{
+    // AVX2 has no scatter, stores are left to the compiler.
+    switch (elementSize)
+    {
+    case 1: return ScatterScalar<uint8>(src, count, swapBytes, dst, stride);
+    case 2: return ScatterScalar<uint16>(src, count, swapBytes, dst, stride);
+    case 4: return ScatterScalar<uint32>(src, count, swapBytes, dst, stride);
+    case 8: return ScatterScalar<uint64>(src, count, swapBytes, dst, stride);
+    }
+    Throw(E_INVALIDARG, L"elementSize should be 1, 2, 4 or 8.");
+}
@@ -0,0 +1,168 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Element kernels of typed arrays, the specializations below select AVX2, SSE2 or scalar code at runtime.
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Gets the index of the first element equals to <paramref name="value"/>, or <paramref name="count"/> if not found.
+    /// </summary>
+    template<typename T>
+    size_t FindElement(const T* data, const size_t count, const T value)
+    {
+        return static_cast<size_t>(std::find(data, data + count, value) - data);
+    }
+
+    /// <summary>
+    /// Converts elements to a type that is able to hold all of them.
+    /// </summary>
+    template<typename TFrom, typename TTo>
+    void WidenElements(const TFrom* src, const size_t count, TTo* dst)
+    {
+        static_assert(std::numeric_limits<TTo>::max() >= std::numeric_limits<TFrom>::max());
+        static_assert(std::numeric_limits<TTo>::lowest() <= std::numeric_limits<TFrom>::lowest());
+        std::copy_n(src, count, dst);
+    }
+
+    /// <summary>
+    /// Checks whether all elements are in range of <typeparamref name="TTo"/>.
+    /// </summary>
+    template<typename TTo, typename TFrom>
+    bool ElementsInRange(const TFrom* src, const size_t count)
+    {
+        if constexpr (std::numeric_limits<TTo>::max() >= std::numeric_limits<TFrom>::max()
+            && std::numeric_limits<TTo>::lowest() <= std::numeric_limits<TFrom>::lowest())
+        {
+            return true;
+        }
+        else
+        {
+            return std::all_of(src, src + count, [](const TFrom value)
+            {
+                return value <= std::numeric_limits<TTo>::max() && value >= std::numeric_limits<TTo>::lowest();
+            });
+        }
+    }
+
+    /// <summary>
+    /// Converts elements which are checked by <see cref="ElementsInRange"/>.
+    /// </summary>
+    template<typename TFrom, typename TTo>
+    void NarrowElements(const TFrom* src, const size_t count, TTo* dst)
+    {
+        if constexpr (std::is_same_v<TFrom, TTo>)
+            std::copy_n(src, count, dst);
+        else
+            std::transform(src, src + count, dst, [](const TFrom value) { return static_cast<TTo>(value); });
+    }
+
+    template<typename T>
+    float64 SumElementsScalar(const T* data, const size_t count)
+    {
+        using TSum = std::conditional_t<std::is_integral_v<T>, int64, float64>;
+        TSum sum = 0;
+        for (size_t i = 0; i < count; i++)
+            sum += data[i];
+        return static_cast<float64>(sum);
+    }
+
+    /// <summary>
+    /// Sums elements, integers are summed exactly.
+    /// </summary>
+    template<typename T>
+    float64 SumElements(const T* data, const size_t count)
+    {
+        return SumElementsScalar(data, count);
+    }
+
+    template<typename T>
+    bool MinMaxElementsScalar(const T* data, const size_t count, T* min, T* max)
+    {
+        auto mn = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+        auto mx = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto value = data[i];
+            // comparisons with NaN are false.
+            if (value < mn)
+                mn = value;
+            if (value > mx)
+                mx = value;
+        }
+        *min = mn;
+        *max = mx;
+        return count != 0 && !(mn > mx);
+    }
+
+    /// <summary>
+    /// Gets the smallest and the largest element, <c>NaN</c> elements are ignored.
+    /// </summary>
+    /// <returns><see langword="false"/> if there is no element to compare.</returns>
+    template<typename T>
+    bool MinMaxElements(const T* data, const size_t count, T* min, T* max)
+    {
+        return MinMaxElementsScalar(data, count, min, max);
+    }
+
+    /// <summary>
+    /// Counts elements in <c>binCount</c> equal width bins over [<paramref name="lower"/>, <paramref name="upper"/>],
+    /// elements out of the range and <c>NaN</c> are ignored.
+    /// </summary>
+    template<typename T>
+    void HistogramElements(const T* data, const size_t count, const float64 lower, const float64 upper, uint32* bins, const uint32 binCount)
+    {
+        // the width overflows for finite bounds far apart, positions are measured in halves then.
+        const auto halve = std::isinf(upper - lower);
+        const auto base = halve ? lower / 2 : lower;
+        const auto width = halve ? upper / 2 - lower / 2 : upper - lower;
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto value = static_cast<float64>(data[i]);
+            if (!(value >= lower && value <= upper))
+                continue;
+            const auto position = ((halve ? value / 2 : value) - base) / width;
+            // upper belongs to the last bin.
+            const auto bin = static_cast<uint32>(std::min(position * binCount, static_cast<float64>(binCount - 1)));
+            bins[bin]++;
+        }
+    }
+
+    /// <summary>
+    /// Copies <paramref name="count"/> elements of <paramref name="elementSize"/> bytes, which are
+    /// <paramref name="stride"/> bytes apart in <paramref name="src"/>, to <paramref name="dst"/> one after another.
+    /// </summary>
+    /// <param name="swapBytes">Whether to reverse bytes of each element.</param>
+    void GatherElements(const uint8* src, const size_t stride, const size_t count, const size_t elementSize, const bool swapBytes, uint8* dst);
+
+    /// <summary>
+    /// Copies <paramref name="count"/> elements of <paramref name="elementSize"/> bytes, which are one after another
+    /// in <paramref name="src"/>, to <paramref name="dst"/> with <paramref name="stride"/> bytes apart.
+    /// </summary>
+    /// <param name="swapBytes">Whether to reverse bytes of each element.</param>
+    void ScatterElements(const uint8* src, const size_t count, const size_t elementSize, const bool swapBytes, uint8* dst, const size_t stride);
+
+    template<> size_t FindElement<int8>(const int8* data, const size_t count, const int8 value);
+    template<> size_t FindElement<uint8>(const uint8* data, const size_t count, const uint8 value);
+    template<> size_t FindElement<int16>(const int16* data, const size_t count, const int16 value);
+    template<> size_t FindElement<uint16>(const uint16* data, const size_t count, const uint16 value);
+    template<> size_t FindElement<int32>(const int32* data, const size_t count, const int32 value);
+    template<> size_t FindElement<uint32>(const uint32* data, const size_t count, const uint32 value);
+    template<> size_t FindElement<float32>(const float32* data, const size_t count, const float32 value);
+    template<> size_t FindElement<float64>(const float64* data, const size_t count, const float64 value);
+
+    template<> float64 SumElements<int16>(const int16* data, const size_t count);
+    template<> float64 SumElements<float32>(const float32* data, const size_t count);
+    template<> float64 SumElements<float64>(const float64* data, const size_t count);
+
+    template<> bool MinMaxElements<uint8>(const uint8* data, const size_t count, uint8* min, uint8* max);
+    template<> bool MinMaxElements<int16>(const int16* data, const size_t count, int16* min, int16* max);
+    template<> bool MinMaxElements<float32>(const float32* data, const size_t count, float32* min, float32* max);
+    template<> bool MinMaxElements<float64>(const float64* data, const size_t count, float64* min, float64* max);
+
+    template<> void WidenElements<int8, int16>(const int8* src, const size_t count, int16* dst);
+    template<> bool ElementsInRange<int8, int16>(const int16* src, const size_t count);
+    template<> void NarrowElements<int16, int8>(const int16* src, const size_t count, int8* dst);
+}
@@ -9,6 +9,7 @@
 #include "JsSymbol.h"
 
 #include "JsObject.h"
+#include "JsObjectTemplate.h"
 #include "JsExternalObject.h"
 #include "JsArray.h"
 #include "JsError.h"
@@ -16,6 +17,8 @@
 #include "JsArrayBuffer.h"
 #include "JsDataView.h"
 #include "JsTypedArray.h"
+#include "JsTypedArrayView.h"
+#include "JsStructCodec.h"
 
 namespace Opportunity::ChakraBridge::WinRT
 {
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsArray.h"
+#include <cstring>
 #include <limits>
 #include <vector>
 
@@ -11,19 +12,113 @@ do{\
         Throw(E_INVALIDARG, _CRT_WIDE(_CRT_STRINGIZE(prop)) L" is too large.");\
 }while (false)
 
+// Fewer items are read one by one.
+constexpr size_t BulkGetThreshold = 8;
+// Arguments of a receiver call, besides this.
+constexpr size_t BulkGetChunk = std::numeric_limits<unsigned short>::max() - 1;
+
+struct GetRangeState
+{
+    IJsValue^* Next;
+    IJsValue^* End;
+};
+
+RawValue ReceiveItems(const RawValue&, const RawValue&, const bool, const RawValue*const arguments, const unsigned short argumentCount, GetRangeState*const& state)
+{
+    for (unsigned short i = 0; i < argumentCount && state->Next != state->End; i++)
+        *state->Next++ = JsValue::CreateTyped(arguments[i]);
+    return RawValue::Undefined();
+}
+
+/// <summary>
+/// Reads <c>arr[start]</c> to <c>arr[end - 1]</c> into <paramref name="items"/>, large ranges are read by the
+/// <c>GetItems</c> helper, which passes up to <see cref="BulkGetChunk"/> items to a native receiver in one call.
+/// Indexes must be checked by the caller.
+/// </summary>
+void GetRange(const RawValue& arr, const uint32 start, const uint32 end, IJsValue^* items)
+{
+    if (end - start < BulkGetThreshold)
+    {
+        for (uint32 i = start; i < end; i++)
+            items[i - start] = JsValue::CreateTyped(arr[RawValue(static_cast<int>(i))]);
+        return;
+    }
+    auto state = GetRangeState{ items, items };
+    const auto receiver = RawValue::CreateFunction<GetRangeState*, ReceiveItems>(&state);
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::GetItems);
+    for (uint32 offset = start; offset < end; offset += BulkGetChunk)
+    {
+        const auto chunkEnd = static_cast<uint32>(std::min(static_cast<size_t>(end), offset + BulkGetChunk));
+        state.Next = items + (offset - start);
+        state.End = items + (chunkEnd - start);
+        void(helper.Invoke(RawValue::Undefined(), arr, RawValue(static_cast<int>(offset)), RawValue(static_cast<int>(chunkEnd)), receiver));
+        // the array is shrunk by script, items past its end are undefined.
+        while (state.Next != state.End)
+            *state.Next++ = JsValue::CreateTyped(RawValue::Undefined());
+    }
+}
+
+// Fewer items are set one by one.
+constexpr size_t BulkSetThreshold = 8;
+// Arguments of a helper call, besides this, target and start.
+constexpr size_t BulkSetChunk = std::numeric_limits<unsigned short>::max() - 3;
+
+/// <summary>
+/// Calls <paramref name="function"/> once per <see cref="BulkSetChunk"/> items, with arguments added by
+/// <paramref name="prefix"/> for the offset of the chunk, followed by the items of the chunk.
+/// </summary>
+template<typename TPrefix>
+void InvokeInChunks(const RawValue& function, IJsValue^const* items, const size_t count, TPrefix prefix)
+{
+    auto args = std::vector<RawValue>();
+    args.reserve(std::min(count, BulkSetChunk) + 3);
+    for (size_t offset = 0; offset < count; offset += BulkSetChunk)
+    {
+        const auto end = std::min(count, offset + BulkSetChunk);
+        args.clear();
+        prefix(static_cast<uint32>(offset), args);
+        for (size_t i = offset; i < end; i++)
+            args.push_back(get_ref_or_undefined(items[i]));
+        function.Invoke(args.data(), static_cast<unsigned int>(args.size()));
+    }
+}
+
+/// <summary>
+/// Sets <c>arr[start + i] = items[i]</c>, large batches are set by the <c>SetItems</c> helper
+/// with one call per <see cref="BulkSetChunk"/> items, <c>start + count</c> must be checked by the caller.
+/// </summary>
+void SetRange(const RawValue& arr, const uint32 start, IJsValue^const* items, const size_t count)
+{
+    if (count < BulkSetThreshold)
+    {
+        for (size_t i = 0; i < count; i++)
+            arr[RawValue(static_cast<int>(start + i))] = get_ref_or_undefined(items[i]);
+        return;
+    }
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::SetItems);
+    InvokeInChunks(helper, items, count, [&arr, start](const uint32 offset, std::vector<RawValue>& args)
+    {
+        args.push_back(RawValue::Undefined());
+        args.push_back(arr);
+        args.push_back(RawValue(static_cast<int>(start + offset)));
+    });
+}
+
 uint32 JsArrayImpl::ArraySize::get()
 {
-    return Reference[L"length"]().ToInt();
+    return Reference[RawPropertyKey::length]().ToInt();
 }
 
 void JsArrayImpl::Append(T^ value)
 {
-    void(Reference[L"push"]().Invoke(Reference, get_ref_or_undefined(value)));
+    StrKeys = nullptr;
+    void(Reference[RawPropertyKey::push]().Invoke(Reference, get_ref_or_undefined(value)));
 }
 
 void JsArrayImpl::ArrayClear()
 {
-    Reference[L"length"] = RawValue(0);
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::length] = RawValue(0);
 }
 
 JsArrayImpl::T^ JsArrayImpl::GetAt(uint32 index)
@@ -36,11 +131,11 @@ uint32 JsArrayImpl::GetMany(uint32 startIndex, write_only_array<T>^ items)
 {
     NULL_CHECK(items);
     ARRAY_INDEX_CHECK(startIndex);
-    auto end = static_cast<uint32>(std::min(static_cast<uint64>(startIndex) + items->Length, static_cast<uint64>(ArraySize)));
-    for (uint32 i = startIndex; i < end; i++)
-    {
-        items[i - startIndex] = GetAt(i);
-    }
+    const auto size = ArraySize;
+    if (startIndex >= size)
+        return 0;
+    const auto end = static_cast<uint32>(std::min(static_cast<uint64>(startIndex) + items->Length, static_cast<uint64>(size)));
+    GetRange(Reference, startIndex, end, items->Data);
     return end - startIndex;
 }
 
@@ -48,17 +143,14 @@ vector_view<JsArrayImpl::T>^ JsArrayImpl::ArrayGetView()
 {
     const auto size = ArraySize;
     auto r = std::vector<T^>(size);
-    for (uint32 i = 0; i < size; i++)
-    {
-        r[i] = GetAt(i);
-    }
+    GetRange(Reference, 0, size, r.data());
     return ref new Platform::Collections::VectorView<T^>(std::move(r));
 }
 
 bool JsArrayImpl::IndexOf(T^ value, uint32* index)
 {
     NULL_CHECK(index);
-    auto rindex = Reference[L"indexOf"]().Invoke(Reference, get_ref_or_undefined(value)).ToInt();
+    auto rindex = Reference[RawPropertyKey::indexOf]().Invoke(Reference, get_ref_or_undefined(value)).ToInt();
     if (rindex < 0)
         return false;
     *index = rindex;
@@ -68,18 +160,21 @@ bool JsArrayImpl::IndexOf(T^ value, uint32* index)
 void JsArrayImpl::InsertAt(uint32 index, T^ value)
 {
     ARRAY_INDEX_CHECK(index);
-    void(Reference[L"splice"]().Invoke(Reference, RawValue(static_cast<int>(index)), RawValue(0), get_ref_or_undefined(value)));
+    StrKeys = nullptr;
+    void(Reference[RawPropertyKey::splice]().Invoke(Reference, RawValue(static_cast<int>(index)), RawValue(0), get_ref_or_undefined(value)));
 }
 
 void JsArrayImpl::RemoveAt(uint32 index)
 {
     ARRAY_INDEX_CHECK(index);
-    void(Reference[L"splice"]().Invoke(Reference, RawValue(static_cast<int>(index)), RawValue(1)));
+    StrKeys = nullptr;
+    void(Reference[RawPropertyKey::splice]().Invoke(Reference, RawValue(static_cast<int>(index)), RawValue(1)));
 }
 
 void JsArrayImpl::RemoveAtEnd()
 {
-    void(Reference[L"pop"]().Invoke(Reference));
+    StrKeys = nullptr;
+    void(Reference[RawPropertyKey::pop]().Invoke(Reference));
 }
 
 void JsArrayImpl::ReplaceAll(const array<T>^ items)
@@ -90,16 +185,15 @@ void JsArrayImpl::ReplaceAll(const array<T>^ items)
         return;
     }
     ARRAY_INDEX_CHECK(items->Length);
-    const auto length = static_cast<int>(items->Length);
-    for (int i = 0; i < length; i++)
-    {
-        SetAt(i, items[i]);
-    }
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::length] = RawValue(static_cast<int>(items->Length));
+    SetRange(Reference, 0, items->Data, items->Length);
 }
 
 void JsArrayImpl::SetAt(uint32 index, T^ value)
 {
     ARRAY_INDEX_CHECK(index);
+    StrKeys = nullptr;
     Reference[RawValue(static_cast<int>(index))] = get_ref_or_undefined(value);
 }
 
@@ -108,12 +202,70 @@ iterator<JsArrayImpl::T>^ JsArrayImpl::ArrayFirst()
     return ArrayGetView()->First();
 }
 
+uint32 JsArrayImpl::CopyToDoubles(write_only_array<float64>^ buffer)
+{
+    NULL_CHECK(buffer);
+    // converts all items in the engine, then copies the storage of the Float64Array.
+    const auto numbers = RawValue::CreateTypedArrayFrom(JsArrayType::Float64, Reference);
+    BYTE* storage;
+    unsigned int storageLen;
+    CHAKRA_CALL(JsGetTypedArrayStorage(numbers.Ref, &storage, &storageLen, nullptr, nullptr));
+    const auto count = std::min(buffer->Length, static_cast<uint32>(storageLen / sizeof(float64)));
+    std::memcpy(buffer->Data, storage, count * sizeof(float64));
+    return count;
+}
+
+void JsArrayImpl::AppendMany(const array<IJsValue>^ items)
+{
+    if (items == nullptr || items->Length == 0)
+        return;
+    const auto newSize = static_cast<uint64>(ArraySize) + items->Length;
+    ARRAY_INDEX_CHECK(newSize);
+    StrKeys = nullptr;
+    // the original push throws for frozen or non-extensible arrays, like Append.
+    const auto& arr = Reference;
+    const auto push = RawHelperFunctions::Lookup(RawHelperFunction::PushItems);
+    InvokeInChunks(push, items->Data, items->Length, [&arr](const uint32, std::vector<RawValue>& args)
+    {
+        args.push_back(arr);
+    });
+}
+
+void JsArrayImpl::InsertRange(uint32 index, const array<IJsValue>^ items)
+{
+    ARRAY_INDEX_CHECK(index);
+    if (items == nullptr || items->Length == 0)
+        return;
+    const auto end = static_cast<uint64>(index) + items->Length;
+    ARRAY_INDEX_CHECK(end);
+    StrKeys = nullptr;
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::InsertItems);
+    const auto& arr = Reference;
+    InvokeInChunks(helper, items->Data, items->Length, [&arr, index](const uint32 offset, std::vector<RawValue>& args)
+    {
+        args.push_back(RawValue::Undefined());
+        args.push_back(arr);
+        args.push_back(RawValue(static_cast<int>(index + offset)));
+    });
+}
+
+void JsArrayImpl::RemoveRange(uint32 index, uint32 count)
+{
+    ARRAY_INDEX_CHECK(index);
+    ARRAY_INDEX_CHECK(count);
+    if (count == 0)
+        return;
+    StrKeys = nullptr;
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::RemoveItems);
+    void(helper.Invoke(RawValue::Undefined(), Reference, RawValue(static_cast<int>(index)), RawValue(static_cast<int>(count))));
+}
+
 template<JsType TExpacted>
 RawValue GetArrayProperty(const wchar_t* name)
 {
     try
     {
-        RawValue value = RawValue::GlobalObject()[L"Array"][name];
+        RawValue value = RawValue::GlobalObject()[RawPropertyKey::Array][name];
         auto valueType = value.Type();
         if (valueType != TExpacted)
             goto GET_FALLBACK;
@@ -125,19 +277,27 @@ RawValue GetArrayProperty(const wchar_t* name)
     }
 GET_FALLBACK:
     const auto arr = RawValue::CreateArray(0);
-    return arr[L"constructor"][name];
+    return arr[RawPropertyKey::constructor][name];
 }
 
 IJsArray^ JsArray::Create(uint32 length)
 {
-    return ref new JsArrayImpl(RawValue::CreateArray(length));
+    return JsWrapperCache::Wrap<JsArrayImpl>(RawValue::CreateArray(length));
 }
 
 IJsArray^ JsArray::Create(vector_view<IJsValue>^ items)
 {
     NULL_CHECK(items);
-    auto ofFunc = ref new JsFunctionImpl(GetArrayProperty<JsType::Function>(L"of"));
-    return safe_cast<IJsArray^>(ofFunc->Invoke(nullptr, items));
+    const auto size = items->Size;
+    ARRAY_INDEX_CHECK(size);
+    const auto arr = RawValue::CreateArray(size);
+    if (size != 0)
+    {
+        auto values = ref new array<IJsValue>(size);
+        const auto count = items->GetMany(0, values);
+        SetRange(arr, 0, values->Data, count);
+    }
+    return JsWrapperCache::Wrap<JsArrayImpl>(arr);
 }
 
 IJsArray^ JsArray::Create(IJsValue^ arrayLike)
@@ -146,3 +306,18 @@ IJsArray^ JsArray::Create(IJsValue^ arrayLike)
     const auto fromFunc = GetArrayProperty<JsType::Function>(L"from");
     return safe_cast<IJsArray^>(JsValue::CreateTyped(fromFunc.Invoke(nullptr, get_ref(arrayLike))));
 }
+
+IJsArray^ JsArray::CreateFromDoubles(const array<float64>^ items)
+{
+    if (items == nullptr || items->Length == 0)
+        return JsWrapperCache::Wrap<JsArrayImpl>(RawValue::CreateArray(0));
+    ARRAY_INDEX_CHECK(items->Length);
+    // copies items to the storage of a Float64Array, then converts it in the engine.
+    const auto numbers = RawValue::CreateTypedArray(JsArrayType::Float64, nullptr, 0, items->Length);
+    BYTE* storage;
+    unsigned int storageLen;
+    CHAKRA_CALL(JsGetTypedArrayStorage(numbers.Ref, &storage, &storageLen, nullptr, nullptr));
+    std::memcpy(storage, items->Data, items->Length * sizeof(float64));
+    const auto fromFunc = GetArrayProperty<JsType::Function>(L"from");
+    return safe_cast<IJsArray^>(JsValue::CreateTyped(fromFunc.Invoke(nullptr, numbers)));
+}
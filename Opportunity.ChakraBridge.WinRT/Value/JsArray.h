@@ -9,6 +9,35 @@ namespace Opportunity::ChakraBridge::WinRT
     /// </summary>
     public interface class IJsArray : IJsObject, vector<IJsValue>
     {
+        /// <summary>
+        /// Copies items of the array to <paramref name="buffer"/> as numbers.
+        /// </summary>
+        /// <param name="buffer">The buffer to copy to.</param>
+        /// <returns>Count of items copied, the smaller one of length of the array and length of <paramref name="buffer"/>.</returns>
+        /// <remarks>Items are converted as storing to a <c>Float64Array</c>, items that are not numbers may become <c>NaN</c>.</remarks>
+        uint32 CopyToDoubles(write_only_array<float64>^ buffer);
+
+        /// <summary>
+        /// Appends items to the end of the array, as <c>Array.prototype.push</c> does.
+        /// </summary>
+        /// <param name="items">Items to append.</param>
+        /// <remarks>Large batches may be appended in several steps, items appended before an error are kept.</remarks>
+        void AppendMany(const array<IJsValue>^ items);
+
+        /// <summary>
+        /// Inserts items at the index of the array, as <c>Array.prototype.splice</c> does.
+        /// </summary>
+        /// <param name="index">The index to insert at.</param>
+        /// <param name="items">Items to insert.</param>
+        /// <remarks>Large batches may be inserted in several steps, items inserted before an error are kept.</remarks>
+        void InsertRange(uint32 index, const array<IJsValue>^ items);
+
+        /// <summary>
+        /// Removes items from the index of the array, as <c>Array.prototype.splice</c> does.
+        /// </summary>
+        /// <param name="index">The index of the first item to remove.</param>
+        /// <param name="count">Count of items to remove.</param>
+        void RemoveRange(uint32 index, uint32 count);
     };
 
     ref class JsArrayImpl sealed : JsObjectImpl, [Default] IJsArray
@@ -24,6 +53,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
@@ -43,6 +78,11 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD_EXPLICT(First, SymFirst, ISymIterator^, ISymIterable);
 
     public:
+        virtual uint32 CopyToDoubles(write_only_array<float64>^ buffer);
+        virtual void AppendMany(const array<IJsValue>^ items);
+        virtual void InsertRange(uint32 index, const array<IJsValue>^ items);
+        virtual void RemoveRange(uint32 index, uint32 count);
+
         using T = IJsValue;
         virtual property uint32 ArraySize { uint32 get() = vector<T>::Size::get; }
         virtual void Append(T^ value);
@@ -95,5 +135,13 @@ namespace Opportunity::ChakraBridge::WinRT
         /// <remarks>Requires an active script context.</remarks>
         [Overload("CreateWithArrayLike")]
         static IJsArray^ Create(IJsValue^ arrayLike);
+
+        /// <summary>
+        /// Creates a JavaScript array object of numbers.
+        /// </summary>
+        /// <param name="items">The initial data of the array.</param>
+        /// <returns>A JavaScript array object.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        static IJsArray^ CreateFromDoubles(const array<float64>^ items);
     };
 }
@@ -2,6 +2,8 @@
 #include "Native\BufferPointer.h"
 #include "JsArrayBuffer.h"
 #include "Native\NativeBuffer.h"
+#include <wrl/wrappers/corewrappers.h>
+#include <limits>
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -15,10 +17,25 @@ void CALLBACK JsArrayBufferImpl::JsFinalizeCallbackImpl(_In_opt_ void *data)
     ExternalBufferKeyMap.erase(data);
 }
 
+void CALLBACK JsArrayBufferImpl::JsMappedFileFinalizeCallbackImpl(_In_opt_ void *data)
+{
+    // ignore error.
+    UnmapViewOfFile(data);
+}
+
 JsArrayBufferImpl::JsArrayBufferImpl(RawValue ref)
-    : JsObjectImpl(std::move(ref))
+    : JsObjectImpl(std::move(ref)) {}
+
+uint8* JsArrayBufferImpl::BufferPtr::get()
+{
+    Storage.Fetch(Reference);
+    return Storage.Ptr;
+}
+
+uint32 JsArrayBufferImpl::BufferLen::get()
 {
-    CHAKRA_CALL(JsGetArrayBufferStorage(Reference.Ref, &BufferPtr, &BufferLen));
+    Storage.Fetch(Reference);
+    return Storage.Len;
 }
 
 IBuffer^ JsArrayBufferImpl::Data::get()
@@ -36,7 +53,7 @@ uint32 JsArrayBufferImpl::ByteLength::get()
 
 IJsArrayBuffer^ JsArrayBuffer::Create(uint32 length)
 {
-    return ref new JsArrayBufferImpl(RawValue::CreateArrayBuffer(length));
+    return JsWrapperCache::Wrap<JsArrayBufferImpl>(RawValue::CreateArrayBuffer(length));
 }
 
 IJsArrayBuffer^ JsArrayBuffer::Create(IBuffer^ buffer)
@@ -48,5 +65,67 @@ IJsArrayBuffer^ JsArrayBuffer::Create(IBuffer^ buffer)
     const auto r = RawValue::CreateArrayBuffer(bufptr, buflen, JsArrayBufferImpl::JsFinalizeCallbackImpl, cb);
     JsArrayBufferImpl::ExternalBufferKeyMap[cb] = r;
     JsArrayBufferImpl::ExternalBufferDataMap[r] = buffer;
-    return ref new JsArrayBufferImpl(r);
-}
\ No newline at end of file
+    return JsWrapperCache::Wrap<JsArrayBufferImpl>(r);
+}
+
+IJsArrayBuffer^ JsArrayBuffer::MapFile(string^ path, uint64 offset, uint32 length, bool readOnly)
+{
+    using namespace Microsoft::WRL::Wrappers;
+    NULL_CHECK(path);
+    // read only maps allow other writers, such as a process still appending to a log.
+    const FileHandle file(CreateFile2(path->Data(),
+        readOnly ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+        readOnly ? FILE_SHARE_READ | FILE_SHARE_WRITE : FILE_SHARE_READ,
+        OPEN_EXISTING, nullptr));
+    if (!file.IsValid())
+        Throw(HRESULT_FROM_WIN32(GetLastError()), L"Failed to open the file.");
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file.Get(), &fileSize))
+        Throw(HRESULT_FROM_WIN32(GetLastError()), L"Failed to get size of the file.");
+    const auto size = static_cast<uint64>(fileSize.QuadPart);
+    if (offset > size)
+        Throw(E_INVALIDARG, L"offset is larger than the size of the file.");
+    auto viewLength = static_cast<uint64>(length);
+    if (length == 0)
+    {
+        viewLength = size - offset;
+        if (viewLength > std::numeric_limits<uint32>::max())
+            Throw(E_INVALIDARG, L"The rest of the file is too large for an array buffer, length should be specified.");
+    }
+    else if (viewLength > size - offset)
+    {
+        Throw(E_INVALIDARG, L"length exceeds the end of the file.");
+    }
+    if (viewLength == 0)
+        Throw(E_INVALIDARG, L"The range to map is empty.");
+
+    // views start at multiples of the allocation granularity.
+    SYSTEM_INFO info;
+    GetNativeSystemInfo(&info);
+    const auto viewOffset = offset / info.dwAllocationGranularity * info.dwAllocationGranularity;
+    const auto viewSize = offset - viewOffset + viewLength;
+    if (viewSize > std::numeric_limits<SIZE_T>::max())
+        Throw(E_INVALIDARG, L"length is too large for the address space.");
+
+    // read only files are mapped copy-on-write, so that writes of script do not fault.
+    const HandleT<HandleTraits::HANDLENullTraits> mapping(CreateFileMappingFromApp(file.Get(), nullptr, readOnly ? PAGE_WRITECOPY : PAGE_READWRITE, 0, nullptr));
+    if (!mapping.IsValid())
+        Throw(HRESULT_FROM_WIN32(GetLastError()), L"Failed to create mapping of the file.");
+    const auto view = MapViewOfFileFromApp(mapping.Get(), readOnly ? FILE_MAP_COPY : FILE_MAP_WRITE, viewOffset, static_cast<SIZE_T>(viewSize));
+    if (view == nullptr)
+        Throw(HRESULT_FROM_WIN32(GetLastError()), L"Failed to map view of the file.");
+
+    // the view keeps the mapping alive after the handles are closed.
+    RawValue r;
+    try
+    {
+        const auto data = static_cast<uint8*>(view) + (offset - viewOffset);
+        r = RawValue::CreateArrayBuffer(data, static_cast<unsigned int>(viewLength), JsArrayBufferImpl::JsMappedFileFinalizeCallbackImpl, view);
+    }
+    catch (...)
+    {
+        UnmapViewOfFile(view);
+        throw;
+    }
+    return JsWrapperCache::Wrap<JsArrayBufferImpl>(r);
+}
@@ -14,6 +14,10 @@ namespace Opportunity::ChakraBridge::WinRT
         /// <summary>
         /// A <see cref="Windows::Storage::Streams::IBuffer"/> to access data of this <see cref="IJsArrayBuffer"/>.
         /// </summary>
+        /// <remarks>
+        /// Requires an active script context to get, the buffer can be used on any thread afterwards,
+        /// such as by async I/O, while no script of the runtime detaches the array buffer.
+        /// </remarks>
         DECL_R_PROPERTY(IBuffer^, Data);
         /// <summary>
         /// Represents the length of the <see cref="IJsArrayBuffer"/> in bytes.
@@ -23,15 +27,20 @@ namespace Opportunity::ChakraBridge::WinRT
 
     ref class JsArrayBufferImpl sealed : JsObjectImpl, [Default] IJsArrayBuffer
     {
+    private:
+        RawStorage<JsType::ArrayBuffer> Storage;
+
     internal:
         // map from reinterpret_cast<void*>(buffer) to reference
         static std::unordered_map<void*, RawValue> ExternalBufferKeyMap;
         // map from reference to IBuffer^
         static std::unordered_map<RawValue, IJsArrayBuffer::IBuffer^> ExternalBufferDataMap;
         static void CALLBACK JsFinalizeCallbackImpl(_In_opt_ void *data);
+        // data is the base address of the mapped view.
+        static void CALLBACK JsMappedFileFinalizeCallbackImpl(_In_opt_ void *data);
 
-        uint8* BufferPtr;
-        unsigned int BufferLen;
+        property uint8* BufferPtr { uint8* get(); }
+        property uint32 BufferLen { uint32 get(); }
 
         JsArrayBufferImpl(RawValue ref);
 
@@ -44,6 +53,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
@@ -93,5 +108,20 @@ namespace Opportunity::ChakraBridge::WinRT
         /// <remarks>Requires an active script context.</remarks>
         [Overload("CreateWithBuffer")]
         static IJsArrayBuffer^ Create(IJsArrayBuffer::IBuffer^ buffer);
+
+        /// <summary>
+        /// Create a new instance of <see cref="IJsArrayBuffer"/> over a memory-mapped view of a file.
+        /// </summary>
+        /// <param name="path">Path of the file, should be accessible by the app.</param>
+        /// <param name="offset">Offset of the view in the file, in bytes.</param>
+        /// <param name="length">Length of the view in bytes, 0 to map to the end of the file.</param>
+        /// <param name="readOnly">
+        /// Whether the file is opened for reading only, the view is copy-on-write then,
+        /// changes made by script are not written to the file.
+        /// Read only maps can be made while other processes have the file open for writing.
+        /// </param>
+        /// <returns>A new instance of <see cref="IJsArrayBuffer"/>, unmapped when it is collected.</returns>
+        /// <remarks>Requires an active script context. Pages are loaded on first access.</remarks>
+        static IJsArrayBuffer^ MapFile(string^ path, uint64 offset, uint32 length, bool readOnly);
     };
 }
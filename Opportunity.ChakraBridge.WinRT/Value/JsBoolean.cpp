@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsBoolean.h"
+#include "JsPrimitiveCache.h"
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -18,15 +19,15 @@ string^ JsBooleanImpl::ToString()
 
 IJsBoolean^ JsBoolean::True::get()
 {
-    return ref new JsBooleanImpl(RawValue::True());
+    return JsPrimitiveCache::Boolean(RawValue::True());
 }
 
 IJsBoolean^ JsBoolean::False::get()
 {
-    return ref new JsBooleanImpl(RawValue::False());
+    return JsPrimitiveCache::Boolean(RawValue::False());
 }
 
 IJsBoolean^ JsBoolean::Create(const bool value)
 {
-    return ref new JsBooleanImpl(RawValue(value));
+    return JsPrimitiveCache::Boolean(value);
 }
\ No newline at end of file
@@ -5,14 +5,23 @@
 using namespace Opportunity::ChakraBridge::WinRT;
 
 JsDataViewImpl::JsDataViewImpl(RawValue ref)
-    : JsObjectImpl(std::move(ref))
+    : JsObjectImpl(std::move(ref)) {}
+
+uint8* JsDataViewImpl::BufferPtr::get()
+{
+    Storage.Fetch(Reference);
+    return Storage.Ptr;
+}
+
+uint32 JsDataViewImpl::BufferLen::get()
 {
-    CHAKRA_CALL(JsGetDataViewStorage(Reference.Ref, &BufferPtr, &BufferLen));
+    Storage.Fetch(Reference);
+    return Storage.Len;
 }
 
 IJsArrayBuffer^ JsDataViewImpl::Buffer::get()
 {
-    return safe_cast<IJsArrayBuffer^>(JsValue::CreateTyped(Reference[L"buffer"]));
+    return safe_cast<IJsArrayBuffer^>(JsValue::CreateTyped(Reference[RawPropertyKey::buffer]));
 }
 
 IBuffer^ JsDataViewImpl::Data::get()
@@ -27,7 +36,7 @@ uint32 JsDataViewImpl::ByteLength::get()
 
 uint32 JsDataViewImpl::ByteOffset::get()
 {
-    return static_cast<uint32>(Reference[ L"byteOffset"]().ToInt());
+    return static_cast<uint32>(Reference[RawPropertyKey::byteOffset]().ToInt());
 }
 
 IJsDataView^ JsDataView::Create(IJsArrayBuffer^ buffer)
@@ -51,5 +60,5 @@ IJsDataView^ JsDataView::Create(IJsArrayBuffer^ buffer, uint32 byteOffset, uint3
     auto buflen = bufferImpl->ByteLength;
     if (byteOffset + byteLength > buflen || byteOffset > buflen || byteLength > buflen)
         Throw(E_INVALIDARG, L"(byteOffset + byteLength) is greater than buffer.ByteLength.");
-    return ref new JsDataViewImpl(RawValue::CreateDataView(get_ref(bufferImpl), byteOffset, byteLength));
+    return JsWrapperCache::Wrap<JsDataViewImpl>(RawValue::CreateDataView(get_ref(bufferImpl), byteOffset, byteLength));
 }
@@ -13,6 +13,10 @@ namespace Opportunity::ChakraBridge::WinRT
         /// <summary>
         /// A <see cref="Windows::Storage::Streams::IBuffer"/> to access data of this <see cref="IJsDataView"/>.
         /// </summary>
+        /// <remarks>
+        /// Requires an active script context to get, the buffer can be used on any thread afterwards,
+        /// while the underlying array buffer is not detached by script.
+        /// </remarks>
         DECL_R_PROPERTY(IBuffer^, Data);
         /// <summary>
         /// Represents the <see cref="IJsArrayBuffer"/> referenced by the <see cref="IJsDataView"/> at construction time.
@@ -30,9 +34,12 @@ namespace Opportunity::ChakraBridge::WinRT
 
     ref class JsDataViewImpl sealed : JsObjectImpl, [Default] IJsDataView
     {
+    private:
+        RawStorage<JsType::DataView> Storage;
+
     internal:
-        uint8 * BufferPtr;
-        unsigned int BufferLen;
+        property uint8* BufferPtr { uint8* get(); }
+        property uint32 BufferLen { uint32 get(); }
 
         JsDataViewImpl(RawValue ref);
 
@@ -45,6 +52,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
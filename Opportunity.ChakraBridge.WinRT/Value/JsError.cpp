@@ -7,7 +7,7 @@ string^ JsErrorImpl::Message::get()
 {
     try
     {
-        return Reference[L"message"]().ToString();
+        return Reference[RawPropertyKey::message]().ToString();
     }
     catch (...)
     {
@@ -17,14 +17,15 @@ string^ JsErrorImpl::Message::get()
 
 void JsErrorImpl::Message::set(string^ value)
 {
-    Reference[L"message"] = RawValue(value->Data(), value->Length());
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::message] = RawValue(value->Data(), value->Length());
 }
 
 string^ JsErrorImpl::Name::get()
 {
     try
     {
-        return Reference[L"name"]().ToString();
+        return Reference[RawPropertyKey::name]().ToString();
     }
     catch (...)
     {
@@ -34,14 +35,15 @@ string^ JsErrorImpl::Name::get()
 
 void JsErrorImpl::Name::set(string^ value)
 {
-    Reference[L"name"] = RawValue(value->Data(), value->Length());
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::name] = RawValue(value->Data(), value->Length());
 }
 
 string^ JsErrorImpl::Stack::get()
 {
     try
     {
-        return Reference[L"stack"]().ToString();
+        return Reference[RawPropertyKey::stack]().ToString();
     }
     catch (...)
     {
@@ -51,19 +53,20 @@ string^ JsErrorImpl::Stack::get()
 
 void JsErrorImpl::Stack::set(string^ value)
 {
-    Reference[L"stack"] = RawValue(value->Data(), value->Length());
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::stack] = RawValue(value->Data(), value->Length());
 }
 
-#define CREATE_ERROR_WITH_JSSTRING(methodName)                                                    \
-IJsError^ JsError::methodName(IJsString^ message)                                                 \
-{                                                                                                 \
-    return ref new JsErrorImpl(RawValue::methodName(get_ref_or_undefined(message)));              \
+#define CREATE_ERROR_WITH_JSSTRING(methodName)                                                                \
+IJsError^ JsError::methodName(IJsString^ message)                                                             \
+{                                                                                                             \
+    return JsWrapperCache::Wrap<JsErrorImpl>(RawValue::methodName(get_ref_or_undefined(message)));            \
 }
 
-#define CREATE_ERROR_WITH_STRING(methodName)                                                       \
-IJsError^ JsError::methodName(string^ message)                                                     \
-{                                                                                                  \
-    return ref new JsErrorImpl(RawValue::methodName(RawValue(message->Data(), message->Length())));\
+#define CREATE_ERROR_WITH_STRING(methodName)                                                                  \
+IJsError^ JsError::methodName(string^ message)                                                                \
+{                                                                                                             \
+    return JsWrapperCache::Wrap<JsErrorImpl>(RawValue::methodName(RawValue(message->Data(), message->Length())));\
 }
 
 CREATE_ERROR_WITH_JSSTRING(CreateError);
@@ -39,6 +39,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
@@ -30,5 +30,5 @@ IJsExternalObject^ JsExternalObject::Create(object^ data)
         delete data; 
     }>(ptr.get());
     ptr.release();
-    return ref new JsExternalObjectImpl(r);
+    return JsWrapperCache::Wrap<JsExternalObjectImpl>(r);
 }
\ No newline at end of file
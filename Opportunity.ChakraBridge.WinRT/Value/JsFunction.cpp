@@ -34,7 +34,7 @@ RawValue JsFunctionImpl::JsNativeFunctionImpl(const RawValue& callee, const RawV
         {
             args[i] = JsValue::CreateTyped(arguments[i]);
         }
-        auto result = func(ref new JsFunctionImpl(callee), callObj, isConstructCall, ref new Platform::Collections::VectorView<IJsValue^>(std::move(args)));
+        auto result = func(JsWrapperCache::Wrap<JsFunctionImpl>(callee), callObj, isConstructCall, ref new Platform::Collections::VectorView<IJsValue^>(std::move(args)));
         return get_ref(result);
     }
     catch (Platform::Exception^ ex)
@@ -46,78 +46,111 @@ RawValue JsFunctionImpl::JsNativeFunctionImpl(const RawValue& callee, const RawV
     }
 }
 
-void getArgs(IJsValue^ caller, vector_view<IJsValue>^ arguments, std::vector<RawValue>& args)
+// Arguments of a call with the caller at first. Short lists are stored inline, long ones use
+// buffers reused by calls on the same thread, a buffer is taken per call so nested calls are safe.
+class CallArguments sealed
 {
-    if (caller == nullptr)
-        args.push_back(RawValue::GlobalObject());
-    else
-        args.push_back(get_ref(caller));
+public:
+    static constexpr unsigned int InlineCount = 8;
+    static constexpr size_t MaxPooledCapacity = 4096;
 
-    if (arguments == nullptr || arguments->Size == 0)
-        return;
-
-    if (arguments->Size > std::numeric_limits<unsigned short>::max() - 1u)
-        Throw(E_INVALIDARG, L"Too many arguments");
-
-    RawValue undef = nullptr;
-
-    for (const auto var : arguments)
+    CallArguments(IJsValue^ caller, vector_view<IJsValue>^ arguments)
     {
-        if (var == nullptr)
-            goto SET_UNDEF;
+        const auto argc = (arguments == nullptr) ? 0u : arguments->Size;
+        if (argc > std::numeric_limits<unsigned short>::max() - 1u)
+            Throw(E_INVALIDARG, L"Too many arguments");
+
+        Count = argc + 1;
+        if (argc <= InlineCount)
+            Values = Inline;
+        else
         {
-            const auto ref = get_ref(var);
-            if (!ref.IsValid())
-                goto SET_UNDEF;
-
-            args.push_back(ref);
-            continue;
+            if (!Pool.empty())
+            {
+                Buffer = std::move(Pool.back());
+                Pool.pop_back();
+            }
+            Buffer.resize(Count);
+            Values = Buffer.data();
         }
 
-    SET_UNDEF:
+        if (caller == nullptr)
+            Values[0] = RawValue::GlobalObject();
+        else
+            Values[0] = get_ref(caller);
+
+        RawValue undef = nullptr;
+        for (unsigned int i = 0; i < argc; i++)
         {
-            if (!undef.IsValid())
-                undef = RawValue::Undefined();
-            args.push_back(undef);
-            continue;
+            auto ref = get_ref(arguments->GetAt(i));
+            if (!ref.IsValid())
+            {
+                if (!undef.IsValid())
+                    undef = RawValue::Undefined();
+                ref = undef;
+            }
+            Values[i + 1] = ref;
         }
     }
-}
+
+    ~CallArguments()
+    {
+        if (Values == Inline || Buffer.capacity() > MaxPooledCapacity)
+            return;
+        Buffer.clear();
+        Pool.push_back(std::move(Buffer));
+    }
+
+    CallArguments(const CallArguments&) = delete;
+    CallArguments& operator =(const CallArguments&) = delete;
+
+    const RawValue* Data() const { return Values; }
+    unsigned int Size() const { return Count; }
+
+private:
+    static thread_local std::vector<std::vector<RawValue>> Pool;
+
+    RawValue Inline[InlineCount + 1];
+    std::vector<RawValue> Buffer;
+    RawValue* Values;
+    unsigned int Count;
+};
+
+thread_local std::vector<std::vector<RawValue>> CallArguments::Pool;
 
 IJsValue^ JsFunctionImpl::Invoke(IJsValue^ caller, vector_view<IJsValue>^ arguments)
 {
-    std::vector<RawValue> args;
-    getArgs(caller, arguments, args);
-    const auto r = Reference.Invoke(&args[0], static_cast<unsigned int>(args.size()));
+    const CallArguments args(caller, arguments);
+    const auto r = Reference.Invoke(args.Data(), args.Size());
     return JsValue::CreateTyped(r);
 }
 
 IJsObject^ JsFunctionImpl::New(vector_view<IJsValue>^ arguments)
 {
-    std::vector<RawValue> args;
-    getArgs(nullptr, arguments, args);
-    const auto r = Reference.New(&args[0], static_cast<unsigned int>(args.size()));
+    const CallArguments args(nullptr, arguments);
+    const auto r = Reference.New(args.Data(), args.Size());
     return safe_cast<IJsObject^>(JsValue::CreateTyped(r));
 }
 
 string^ JsFunctionImpl::Name::get()
 {
-    return Reference[L"name"]().ToString();
+    return Reference[RawPropertyKey::name]().ToString();
 }
 
 int32 JsFunctionImpl::Length::get()
 {
-    return Reference[L"length"]().ToInt();
+    return Reference[RawPropertyKey::length]().ToInt();
 }
 
 IJsObject^ JsFunctionImpl::Prototype::get()
 {
-    return dynamic_cast<IJsObject^>(JsValue::CreateTyped(Reference[L"prototype"]));
+    return dynamic_cast<IJsObject^>(JsValue::CreateTyped(Reference[RawPropertyKey::prototype]));
 }
 
 void JsFunctionImpl::Prototype::set(IJsObject^ value)
 {
-    Reference[L"prototype"] = get_ref_or_undefined(value);
+    StrKeys = nullptr;
+    Reference[RawPropertyKey::prototype] = get_ref_or_undefined(value);
 }
 
 string^ JsFunctionImpl::ToString()
@@ -133,7 +166,7 @@ IJsFunction^ JsFunction::Create(JsFunctionDelegate^ function)
     NULL_CHECK(function);
     auto ptr = std::make_unique<JsFunctionImpl::FW>(function);
     const auto ref = RawValue::CreateFunction<JsFunctionImpl::FWP, JsFunctionImpl::JsNativeFunctionImpl>(ptr.get());
-    auto func = ref new JsFunctionImpl(ref);
+    auto func = JsWrapperCache::Wrap<JsFunctionImpl>(ref);
     func->InitForNativeFunc(std::move(ptr));
     return func;
 }
@@ -145,7 +178,7 @@ IJsFunction^ JsFunction::Create(JsFunctionDelegate^ function, IJsString^ name)
     NULL_CHECK(function);
     auto ptr = std::make_unique<JsFunctionImpl::FW>(function);
     const auto ref = RawValue::CreateFunction<JsFunctionImpl::FWP, JsFunctionImpl::JsNativeFunctionImpl>(get_ref(name), ptr.get());
-    auto func = ref new JsFunctionImpl(ref);
+    auto func = JsWrapperCache::Wrap<JsFunctionImpl>(ref);
     func->InitForNativeFunc(std::move(ptr));
     return func;
 }
@@ -157,7 +190,7 @@ IJsFunction^ JsFunction::Create(JsFunctionDelegate^ function, string^ name)
     NULL_CHECK(function);
     auto ptr = std::make_unique<JsFunctionImpl::FW>(function);
     const auto ref = RawValue::CreateFunction<JsFunctionImpl::FWP, JsFunctionImpl::JsNativeFunctionImpl>(RawValue(name->Data(), name->Length()), ptr.get());
-    auto func = ref new JsFunctionImpl(ref);
+    auto func = JsWrapperCache::Wrap<JsFunctionImpl>(ref);
     func->InitForNativeFunc(std::move(ptr));
     return func;
 }
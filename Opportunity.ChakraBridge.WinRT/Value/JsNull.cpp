@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsNull.h"
+#include "JsPrimitiveCache.h"
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -10,5 +11,5 @@ string^ JsNullImpl::ToString() { return L"null"; }
 
 IJsNull^ JsNull::Instance::get()
 {
-    return ref new JsNullImpl(RawValue::Null());
+    return JsPrimitiveCache::Null(RawValue::Null());
 }
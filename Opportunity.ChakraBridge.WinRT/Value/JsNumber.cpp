@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsNumber.h"
+#include "JsPrimitiveCache.h"
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -18,12 +19,12 @@ float64 JsNumberImpl::ToDouble()
 
 string^ JsNumberImpl::ToString()
 {
-    return Reference.ToJsString().ToString();
+    return Reference.PrimitiveToJsString().ToString();
 }
 
 IJsNumber^ JsNumber::Create(int32 value)
 {
-    return ref new JsNumberImpl(RawValue(static_cast<int>(value)));
+    return JsPrimitiveCache::Number(static_cast<int>(value));
 }
 
 IJsNumber^ JsNumber::Create(float64 value)
@@ -1,7 +1,11 @@
 #include "pch.h"
 #include "JsObject.h"
+#include "JsWrapperCache.h"
+#include "JsObjectView.h"
 #include <vector>
 #include <sstream>
+#include <cwchar>
+#include <limits>
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -12,7 +16,7 @@ JsObjectImpl::~JsObjectImpl()
 }
 
 JsObjectImpl::JsObjectImpl(RawValue ref)
-    :JsValueImpl(std::move(ref))
+    :JsValueImpl(std::move(ref)), UseKeySnapshot(false), StrKeyCount(0), SymKeyCount(0)
 {
     Reference.AddRef();
 }
@@ -44,6 +48,8 @@ bool JsObjectImpl::Insert(string^ key, IJsValue^ value)
     const auto prop = Reference[key->Data()];
     bool r = prop.Exist();
     prop = get_ref_or_undefined(value);
+    // the probe also finds properties of the prototype chain, an own property may be created anyway.
+    StrKeys = nullptr;
     return r;
 }
 
@@ -53,38 +59,170 @@ bool JsObjectImpl::Insert(IJsSymbol^ key, IJsValue^ value)
     const auto prop = Reference[get_ref(key)];
     bool r = prop.Exist();
     prop = get_ref_or_undefined(value);
+    // the probe also finds properties of the prototype chain, an own property may be created anyway.
+    SymKeys = nullptr;
     return r;
 }
 
+// Fewer properties are set or deleted one by one.
+constexpr size_t BulkAssignThreshold = 8;
+// Arguments of a helper call, besides this, target and keys.
+constexpr size_t BulkAssignChunk = std::numeric_limits<unsigned short>::max() - 3;
+
+bool HasNulKey(string^const* keys, const size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (std::wmemchr(keys[i]->Data(), L'\0', keys[i]->Length()) != nullptr)
+            return true;
+    }
+    return false;
+}
+
+void AssignPropertiesByIds(const RawValue& target, string^const* keys, const RawValue* values, const size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto key = keys[i];
+        // ids are resolved from null-terminated names, keys containing '\0' are set by string values.
+        if (std::wmemchr(key->Data(), L'\0', key->Length()) != nullptr)
+            target[RawValue(key->Data(), key->Length())] = values[i];
+        else
+            target[RawPropertyIdTable::Lookup(key->Data(), key->Length())] = values[i];
+    }
+}
+
+/// <summary>
+/// Sets <c>target[keys[i]] = values[i]</c>, large batches are set by the <c>AssignProperties</c> helper
+/// with one call per <see cref="BulkAssignChunk"/> properties.
+/// </summary>
+void AssignProperties(const RawValue& target, string^const* keys, const RawValue* values, const size_t count)
+{
+    // keys are joined by '\0' for the helper, all properties are set one by one if any key contains it.
+    if (count < BulkAssignThreshold || HasNulKey(keys, count))
+        return AssignPropertiesByIds(target, keys, values, count);
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::AssignProperties);
+    auto args = std::vector<RawValue>();
+    args.reserve(std::min(count, BulkAssignChunk) + 3);
+    std::wstring joined;
+    for (size_t start = 0; start < count; start += BulkAssignChunk)
+    {
+        const auto end = std::min(count, start + BulkAssignChunk);
+        joined.clear();
+        for (size_t i = start; i < end; i++)
+        {
+            if (i != start)
+                joined.push_back(L'\0');
+            joined.append(keys[i]->Data(), keys[i]->Length());
+        }
+        args.clear();
+        args.push_back(RawValue::Undefined());
+        args.push_back(target);
+        args.push_back(RawValue(joined));
+        args.insert(args.end(), values + start, values + end);
+        helper.Invoke(args.data(), static_cast<unsigned int>(args.size()));
+    }
+}
+
+/// <summary>
+/// Deletes <c>target[keys[i]]</c> of the key array, large batches are deleted by one call of the
+/// <c>DeleteProperties</c> helper.
+/// </summary>
+void DeleteProperties(const RawValue& target, const RawValue& keys)
+{
+    const auto count = keys[RawPropertyKey::length]().ToInt();
+    if (count <= 0)
+        return;
+    if (static_cast<size_t>(count) < BulkAssignThreshold)
+    {
+        for (int i = 0; i < count; i++)
+            target[keys[RawValue(i)]].Delete();
+        return;
+    }
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::DeleteProperties);
+    helper.Invoke(RawValue::Undefined(), target, keys);
+}
+
+void AssignProperties(const RawValue& target, map_view<string, IJsValue>^const items)
+{
+    auto pairs = ref new array<kv_pair<string, IJsValue>^>(items->Size);
+    const auto count = items->First()->GetMany(pairs);
+    auto keys = std::vector<string^>(count);
+    auto values = std::vector<RawValue>(count);
+    for (uint32 i = 0; i < count; i++)
+    {
+        keys[i] = pairs[i]->Key;
+        values[i] = get_ref_or_undefined(pairs[i]->Value);
+    }
+    AssignProperties(target, keys.data(), values.data(), count);
+}
+
+array<IJsValue>^ JsObjectImpl::GetProperties(const array<string>^ keys)
+{
+    NULL_CHECK(keys);
+    auto result = ref new array<IJsValue>(keys->Length);
+    for (uint32 i = 0; i < result->Length; i++)
+    {
+        // getters may run script and collect values not referenced from the stack, wrap each value at once.
+        const auto key = keys[i];
+        // ids are resolved from null-terminated names, keys containing '\0' are read by string values.
+        if (std::wmemchr(key->Data(), L'\0', key->Length()) != nullptr)
+            result[i] = JsValue::CreateTyped(Reference[RawValue(key->Data(), key->Length())]);
+        else
+            result[i] = JsValue::CreateTyped(Reference[RawPropertyIdTable::Lookup(key->Data(), key->Length())]);
+    }
+    return result;
+}
+
+void JsObjectImpl::SetProperties(const array<string>^ keys, const array<IJsValue>^ values)
+{
+    NULL_CHECK(keys);
+    NULL_CHECK(values);
+    if (keys->Length != values->Length)
+        Throw(E_INVALIDARG, L"keys and values have different length.");
+    auto refs = std::vector<RawValue>(values->Length);
+    for (uint32 i = 0; i < values->Length; i++)
+        refs[i] = get_ref_or_undefined(values[i]);
+    AssignProperties(Reference, keys->Data, refs.data(), refs.size());
+    StrKeys = nullptr;
+}
+
+void JsObjectImpl::InsertMany(IStrMapView^ items)
+{
+    NULL_CHECK(items);
+    AssignProperties(Reference, items);
+    StrKeys = nullptr;
+}
+
+void JsObjectImpl::SetProperty(string^ key, IJsValue^ value)
+{
+    Reference[key->Data()] = get_ref_or_undefined(value);
+    StrKeys = nullptr;
+}
+
 void JsObjectImpl::Remove(string^ key)
 {
     void(Reference[key->Data()].Delete());
+    StrKeys = nullptr;
 }
 
 void JsObjectImpl::Remove(IJsSymbol^ key)
 {
     NULL_CHECK(key);
     Reference[get_ref(key)].Delete();
+    SymKeys = nullptr;
 }
 
 void JsObjectImpl::StrClear()
 {
-    const auto arr = Reference.ObjOwnPropertyNames();
-    const auto n = arr[L"length"]().ToInt();
-    for (int i = 0; i < n; i++)
-    {
-        Reference[arr[RawValue(i)]].Delete();
-    }
+    StrKeys = nullptr;
+    DeleteProperties(Reference, Reference.ObjOwnPropertyNames());
 }
 
 void JsObjectImpl::SymClear()
 {
-    const auto arr = Reference.ObjOwnPropertySymbols();
-    const auto n = arr[L"length"]().ToInt();
-    for (int i = 0; i < n; i++)
-    {
-        Reference[arr[RawValue(i)]].Delete();
-    }
+    SymKeys = nullptr;
+    DeleteProperties(Reference, Reference.ObjOwnPropertySymbols());
 }
 
 JsObjectImpl::IStrIterator^ JsObjectImpl::StrFirst()
@@ -99,39 +237,68 @@ JsObjectImpl::ISymIterator^ JsObjectImpl::SymFirst()
 
 JsObjectImpl::IStrMapView^ JsObjectImpl::GetStrView()
 {
-    const auto arr = Reference.ObjOwnPropertyNames();
-    const auto n = arr[L"length"]().ToInt();
-    auto view = ref new Platform::Collections::UnorderedMap<string^, IJsValue^>(static_cast<size_t>(n));
-    for (int i = 0; i < n; i++)
-    {
-        const auto kf = arr[RawValue(i)]();
-        auto k = kf.ToString();
-        view->Insert(k, JsValue::CreateTyped(Reference[kf]));
-    }
-    return view->GetView();
+    if (!UseKeySnapshot)
+        return ref new JsObjectViewImpl<string>(this);
+    SnapshotStrKeys();
+    return ref new JsObjectViewImpl<string>(this, StrKeys, 0, StrKeyCount);
 }
 
 JsObjectImpl::ISymMapView^ JsObjectImpl::GetSymView()
 {
-    const auto arr = Reference.ObjOwnPropertySymbols();
-    const auto n = arr[L"length"]().ToInt();
-    auto view = ref new Platform::Collections::UnorderedMap<IJsSymbol^, IJsValue^>(static_cast<size_t>(n));
-    for (int i = 0; i < n; i++)
-    {
-        const auto kf = arr[RawValue(i)]();
-        view->Insert(ref new JsSymbolImpl(kf), JsValue::CreateTyped(Reference[kf]));
-    }
-    return view->GetView();
+    if (!UseKeySnapshot)
+        return ref new JsObjectViewImpl<IJsSymbol>(this);
+    SnapshotSymKeys();
+    return ref new JsObjectViewImpl<IJsSymbol>(this, SymKeys, 0, SymKeyCount);
 }
 
 uint32 JsObjectImpl::StrSize::get()
 {
-    return static_cast<uint32>(Reference.ObjOwnPropertyNames()[L"length"]().ToInt());
+    if (!UseKeySnapshot)
+        return static_cast<uint32>(Reference.ObjOwnPropertyNames()[RawPropertyKey::length]().ToInt());
+    SnapshotStrKeys();
+    return StrKeyCount;
 }
 
 uint32 JsObjectImpl::SymSize::get()
 {
-    return static_cast<uint32>(Reference.ObjOwnPropertySymbols()[L"length"]().ToInt());
+    if (!UseKeySnapshot)
+        return static_cast<uint32>(Reference.ObjOwnPropertySymbols()[RawPropertyKey::length]().ToInt());
+    SnapshotSymKeys();
+    return SymKeyCount;
+}
+
+void JsObjectImpl::SnapshotStrKeys()
+{
+    if (StrKeys != nullptr)
+        return;
+    StrKeys = ref new JsObjectImpl(Reference.ObjOwnPropertyNames());
+    StrKeyCount = static_cast<uint32>(StrKeys->Reference[RawPropertyKey::length]().ToInt());
+}
+
+void JsObjectImpl::SnapshotSymKeys()
+{
+    if (SymKeys != nullptr)
+        return;
+    SymKeys = ref new JsObjectImpl(Reference.ObjOwnPropertySymbols());
+    SymKeyCount = static_cast<uint32>(SymKeys->Reference[RawPropertyKey::length]().ToInt());
+}
+
+bool JsObjectImpl::KeySnapshotEnabled::get()
+{
+    return UseKeySnapshot;
+}
+
+void JsObjectImpl::KeySnapshotEnabled::set(bool value)
+{
+    UseKeySnapshot = value;
+    if (!value)
+        Refresh();
+}
+
+void JsObjectImpl::Refresh()
+{
+    StrKeys = nullptr;
+    SymKeys = nullptr;
 }
 
 string^ JsObjectImpl::ToString()
@@ -183,6 +350,8 @@ void JsObjectImpl::JsObjectBeforeCollectCallbackImpl(const RawValue& ref, const
     {
         if (state->InternalBeforeCollectCallback)
             state->InternalBeforeCollectCallback(ref);
+        if (state->Cache)
+            state->Cache->Remove(ref);
     }
     catch (...)
     {
@@ -193,7 +362,7 @@ void JsObjectImpl::JsObjectBeforeCollectCallbackImpl(const RawValue& ref, const
     {
         auto obj = callbackState->Object.Resolve<JsObjectImpl>();
         if (obj == nullptr)
-            obj = safe_cast<JsObjectImpl^>(JsValue::CreateTyped(ref));
+            obj = JsValue::CreateObject(ref, ref.Type());
         cbfunc(obj);
     }
 }
@@ -224,6 +393,45 @@ void JsObjectImpl::RegisterInternalBeforeCollectCallback(IBCC*const callback)
     }
 }
 
+/// <summary>
+/// Attaches <paramref name="cache"/> to the object, so that its entry is removed when the object is collected.
+/// </summary>
+/// <returns><see langword="false"/> if the object has been attached to another cache.</returns>
+bool JsObjectImpl::RegisterWrapperCache(JsWrapperCache*const cache)
+{
+    auto v = OBCCMap.find(Reference);
+    const auto hasValue = (v != OBCCMap.end());
+
+    if (hasValue)
+    {
+        if (v->second->Cache != nullptr && v->second->Cache != cache)
+            return false;
+        v->second->Object = this;
+        v->second->Cache = cache;
+    }
+    else
+    {
+        auto newValue = std::make_unique<OW>(this, nullptr, nullptr);
+        newValue->Cache = cache;
+        Reference.ObjBeforeCollectCallback<OWP, JsObjectBeforeCollectCallbackImpl>(newValue.get());
+        OBCCMap[Reference] = std::move(newValue);
+    }
+    return true;
+}
+
+/// <summary>
+/// Detaches <paramref name="cache"/> from the object.
+/// </summary>
+/// <remarks>
+/// The engine callback is kept, the entry will be dropped when the object is collected.
+/// </remarks>
+void JsObjectImpl::UnregisterWrapperCache(const RawValue& ref, const JsWrapperCache*const cache)
+{
+    const auto v = OBCCMap.find(ref);
+    if (v != OBCCMap.end() && v->second->Cache == cache)
+        v->second->Cache = nullptr;
+}
+
 void JsObjectImpl::ObjectCollectingCallback::set(JsOBCC^ value)
 {
     auto v = OBCCMap.find(Reference);
@@ -261,25 +469,30 @@ JsObjectImpl::JsOBCC^ JsObjectImpl::ObjectCollectingCallback::get()
 
 IJsObject^ JsObject::Create()
 {
-    return ref new JsObjectImpl(RawValue::CreateObject());
+    return JsWrapperCache::Wrap<JsObjectImpl>(RawValue::CreateObject());
 }
 
 IJsObject^ JsObject::Create(map_view<string, IJsValue>^ properties)
 {
-    auto obj = Create();
     if (properties == nullptr)
-        return obj;
-    const auto ref = get_ref(obj);
-    const auto udf = RawValue::Undefined();
-    for (const auto var : properties)
-    {
-        const auto value = var->Value;
-        if (value == nullptr)
-            ref[var->Key->Data()] = udf;
-        else
-            ref[var->Key->Data()] = get_ref(value);
-    }
-    return obj;
+        return Create();
+    const auto obj = RawValue::CreateObject();
+    AssignProperties(obj, properties);
+    return JsWrapperCache::Wrap<JsObjectImpl>(obj);
+}
+
+IJsObject^ JsObject::Create(const array<string>^ keys, const array<IJsValue>^ values)
+{
+    NULL_CHECK(keys);
+    NULL_CHECK(values);
+    if (keys->Length != values->Length)
+        Throw(E_INVALIDARG, L"keys and values have different length.");
+    auto refs = std::vector<RawValue>(values->Length);
+    for (uint32 i = 0; i < values->Length; i++)
+        refs[i] = get_ref_or_undefined(values[i]);
+    const auto obj = RawValue::CreateObject();
+    AssignProperties(obj, keys->Data, refs.data(), refs.size());
+    return JsWrapperCache::Wrap<JsObjectImpl>(obj);
 }
 
 IJsObject^ JsObject::Create(map_view<IJsValue, IJsValue>^ properties)
@@ -330,13 +543,13 @@ bool JsObject::DefineProperty(IJsObject^ obj, IJsSymbol^ propertyId, IJsObject^
 IJsArray^ JsObject::GetOwnPropertyNames(IJsObject^ obj)
 {
     NULL_CHECK(obj);
-    return ref new JsArrayImpl(get_ref(obj).ObjOwnPropertyNames());
+    return JsWrapperCache::Wrap<JsArrayImpl>(get_ref(obj).ObjOwnPropertyNames());
 }
 
 IJsArray^ JsObject::GetOwnPropertySymbols(IJsObject^ obj)
 {
     NULL_CHECK(obj);
-    return ref new JsArrayImpl(get_ref(obj).ObjOwnPropertySymbols());
+    return JsWrapperCache::Wrap<JsArrayImpl>(get_ref(obj).ObjOwnPropertySymbols());
 }
 
 IJsObject^ InnerGetOwnPropertyDescriptor(IJsObject^ obj, RawPropertyId propertyId)
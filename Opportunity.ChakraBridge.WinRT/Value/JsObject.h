@@ -7,6 +7,8 @@
 
 namespace Opportunity::ChakraBridge::WinRT
 {
+    struct JsWrapperCache;
+
     /// <summary>
     /// A callback called before collecting an object.
     /// </summary>
@@ -40,6 +42,59 @@ namespace Opportunity::ChakraBridge::WinRT
         /// A callback function that is called by the runtime before garbage collection of the object. 
         /// </summary>
         DECL_RW_PROPERTY(JsObjectBeforeCollectCallback^, ObjectCollectingCallback);
+
+        /// <summary>
+        /// Gets values of several properties in one call.
+        /// </summary>
+        /// <param name="keys">Names of properties to get.</param>
+        /// <returns>Values of properties, in the same order of <paramref name="keys"/>.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        array<IJsValue>^ GetProperties(const array<string>^ keys);
+
+        /// <summary>
+        /// Sets values of several properties in one call.
+        /// </summary>
+        /// <param name="keys">Names of properties to set.</param>
+        /// <param name="values">Values of properties, in the same order of <paramref name="keys"/>.</param>
+        /// <remarks>Requires an active script context.</remarks>
+        void SetProperties(const array<string>^ keys, const array<IJsValue>^ values);
+
+        /// <summary>
+        /// Gets or sets a value indicating whether own keys of the object are cached for <c>Size</c>, <c>GetView</c> and <c>First</c>.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// The cached keys are dropped by methods and properties of this object that write properties,
+        /// call <see cref="Refresh()"/> after properties are added or removed by script.
+        /// </para>
+        /// <para>
+        /// Wrappers are shared by all holders of the same object in a context, so is this setting.
+        /// </para>
+        /// </remarks>
+        DECL_RW_PROPERTY(bool, KeySnapshotEnabled);
+
+        /// <summary>
+        /// Drops cached own keys of the object.
+        /// </summary>
+        void Refresh();
+
+        /// <summary>
+        /// Sets values of several properties in one call, existence of the properties is not checked.
+        /// </summary>
+        /// <param name="items">Names and values of properties to set.</param>
+        /// <remarks>Requires an active script context.</remarks>
+        void InsertMany(map_view<string, IJsValue>^ items);
+
+        /// <summary>
+        /// Sets value of a property, existence of the property is not checked.
+        /// </summary>
+        /// <param name="key">Name of property to set.</param>
+        /// <param name="value">Value of property.</param>
+        /// <remarks>
+        /// <para>Works as <c>Insert</c> without its result, for callers that discard it.</para>
+        /// <para>Requires an active script context.</para>
+        /// </remarks>
+        void SetProperty(string^ key, IJsValue^ value);
     };
 
     ref class JsObjectImpl : JsValueImpl, [Default] IJsObject
@@ -66,12 +121,13 @@ namespace Opportunity::ChakraBridge::WinRT
             JsOBCC^ BeforeCollectCallback;
             weak_ref Object;
             IBCC* InternalBeforeCollectCallback;
+            JsWrapperCache* Cache;
             OW(JsValueImpl^const thisObj, JsOBCC^const callback, IBCC*const callback2)
-                :Object(thisObj),BeforeCollectCallback(callback), InternalBeforeCollectCallback(callback2){}
+                :Object(thisObj),BeforeCollectCallback(callback), InternalBeforeCollectCallback(callback2), Cache(nullptr){}
 
             bool InUse()
             {
-                return BeforeCollectCallback != nullptr || InternalBeforeCollectCallback != nullptr;
+                return BeforeCollectCallback != nullptr || InternalBeforeCollectCallback != nullptr || Cache != nullptr;
             }
         }*;
 
@@ -80,9 +136,19 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_R_PROPERTY(Context, JsContext^, IJsValue);
         INHERIT_INTERFACE_METHOD(ToInspectable, object^, IJsValue);
 
+        bool UseKeySnapshot;
+        JsObjectImpl^ StrKeys;
+        JsObjectImpl^ SymKeys;
+        uint32 StrKeyCount;
+        uint32 SymKeyCount;
+        void SnapshotStrKeys();
+        void SnapshotSymKeys();
+
         static std::unordered_map<RawValue, std::unique_ptr<OW>> OBCCMap;
         static void JsObjectBeforeCollectCallbackImpl(const RawValue& ref, const OWP& callbackState);
         void RegisterInternalBeforeCollectCallback(IBCC*const callback);
+        bool RegisterWrapperCache(JsWrapperCache*const cache);
+        static void UnregisterWrapperCache(const RawValue& ref, const JsWrapperCache*const cache);
 
     public:
         virtual Platform::String^ ToString() override;
@@ -91,6 +157,12 @@ namespace Opportunity::ChakraBridge::WinRT
         virtual void PreventExtension();
         virtual DECL_R_PROPERTY(bool, IsExtensionAllowed);
         virtual DECL_RW_PROPERTY(JsOBCC^, ObjectCollectingCallback);
+        virtual array<IJsValue>^ GetProperties(const array<string>^ keys);
+        virtual void SetProperties(const array<string>^ keys, const array<IJsValue>^ values);
+        virtual DECL_RW_PROPERTY(bool, KeySnapshotEnabled);
+        virtual void Refresh();
+        virtual void InsertMany(IStrMapView^ items);
+        virtual void SetProperty(string^ key, IJsValue^ value);
 
         virtual IJsValue^ Lookup(string^ key);
         virtual void Remove(string^ key);
@@ -146,6 +218,24 @@ namespace Opportunity::ChakraBridge::WinRT
         [Overload("CreateWithJsValueMap")]
         static IJsObject^ Create(map_view<IJsValue, IJsValue>^ properties);
 
+        /// <summary>
+        /// Creates a new <see cref="IJsObject"/> with properties.
+        /// </summary>
+        /// <param name="keys">Names of properties to inintialize the new <see cref="IJsObject"/>.</param>
+        /// <param name="values">Values of properties, in the same order of <paramref name="keys"/>.</param>
+        /// <returns>A new <see cref="IJsObject"/> with properties.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        [Overload("CreateWithProperties")]
+        static IJsObject^ Create(const array<string>^ keys, const array<IJsValue>^ values);
+
+        /// <summary>
+        /// Creates a new <see cref="IJsObjectTemplate"/> to create objects with the same set of properties.
+        /// </summary>
+        /// <param name="keys">Names of properties of objects created by the template.</param>
+        /// <returns>A new <see cref="IJsObjectTemplate"/>.</returns>
+        /// <remarks>Keys can't contain '\0'.</remarks>
+        static IJsObjectTemplate^ CreateTemplate(const array<string>^ keys);
+
         /// <summary>
         /// Performs JavaScript "instanceof" operator test. 
         /// </summary>
@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "JsObjectTemplate.h"
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+using namespace Opportunity::ChakraBridge::WinRT;
+
+// Objects with more properties are created without the constructor, as the arguments will not fit in a call.
+constexpr size_t MaxConstructorKeys = std::numeric_limits<unsigned short>::max() - 1;
+// Arguments of a DefineProperties call, besides this, target and keys.
+constexpr size_t DefineChunk = std::numeric_limits<unsigned short>::max() - 3;
+
+JsObjectTemplateImpl::JsObjectTemplateImpl(std::vector<std::wstring> keys)
+    : KeyNames(std::move(keys)), Constructor(nullptr), ConstructorContext(nullptr)
+{
+    const auto owner = JsRuntime::Get(RawContext::Current().Runtime());
+    _ASSERTE(owner != nullptr);
+    Owner = owner;
+}
+
+JsObjectTemplateImpl::~JsObjectTemplateImpl()
+{
+    // pinned values have been freed with the runtime.
+    if (GetOwner() == nullptr)
+        return;
+    // ignore error.
+    if (Constructor.IsValid())
+        JsRelease(Constructor.Ref, nullptr);
+}
+
+static void AppendJsStringLiteral(std::wostringstream& source, const std::wstring& value)
+{
+    source << L'"';
+    for (const auto ch : value)
+    {
+        if (ch == L'"' || ch == L'\\')
+            source << L'\\' << ch;
+        else if (ch < 0x20 || ch == 0x2028 || ch == 0x2029)
+            source << L"\\u" << std::hex << std::setw(4) << std::setfill(L'0') << static_cast<unsigned int>(ch) << std::dec;
+        else
+            source << ch;
+    }
+    source << L'"';
+}
+
+/// <summary>
+/// Gets the runtime that owns ids of the template, or <see langword="null"/> if it has been disposed.
+/// </summary>
+JsRuntime^ JsObjectTemplateImpl::GetOwner()
+{
+    const auto owner = Owner.Resolve<JsRuntime>();
+    // the handle of a disposed runtime may be reused by another one.
+    if (owner == nullptr || JsRuntime::Get(owner->Handle) != owner)
+        return nullptr;
+    return owner;
+}
+
+/// <summary>
+/// Gets the constructor for the current context, or an invalid reference if objects should be created property by property.
+/// </summary>
+RawValue JsObjectTemplateImpl::GetConstructor()
+{
+    if (KeyNames.size() > MaxConstructorKeys)
+        return nullptr;
+    const auto context = RawContext::Current();
+    if (Constructor.IsValid())
+        return context == ConstructorContext ? Constructor : nullptr;
+
+    // keys are computed, so "__proto__" is an own property as it is with DefineProperties.
+    std::wostringstream source;
+    source << L"(function(){var a=arguments;return{";
+    for (size_t i = 0; i < KeyNames.size(); i++)
+    {
+        if (i != 0)
+            source << L',';
+        source << L'[';
+        AppendJsStringLiteral(source, KeyNames[i]);
+        source << L"]:a[" << i << L']';
+    }
+    source << L"};})";
+    const auto constructor = RawContext::RunScript(source.str().c_str(), JS_SOURCE_CONTEXT_NONE, L"");
+    constructor.AddRef();
+    Constructor = constructor;
+    ConstructorContext = context;
+    return Constructor;
+}
+
+/// <summary>
+/// Defines properties of the template on <paramref name="obj"/> with the <c>DefineProperties</c> helper,
+/// which gives the same properties as the constructor.
+/// </summary>
+void JsObjectTemplateImpl::DefineProperties(const RawValue& obj, const RawValue* values)
+{
+    if (JoinedKeys.empty())
+    {
+        for (size_t start = 0; start < KeyNames.size(); start += DefineChunk)
+        {
+            const auto end = std::min(KeyNames.size(), start + DefineChunk);
+            std::wstring joined;
+            for (size_t i = start; i < end; i++)
+            {
+                if (i != start)
+                    joined.push_back(L'\0');
+                joined.append(KeyNames[i]);
+            }
+            JoinedKeys.push_back(std::move(joined));
+        }
+    }
+    const auto helper = RawHelperFunctions::Lookup(RawHelperFunction::DefineProperties);
+    auto args = std::vector<RawValue>();
+    args.reserve(std::min(KeyNames.size(), DefineChunk) + 3);
+    for (size_t chunk = 0; chunk < JoinedKeys.size(); chunk++)
+    {
+        const auto start = chunk * DefineChunk;
+        const auto end = std::min(KeyNames.size(), start + DefineChunk);
+        args.clear();
+        args.push_back(RawValue::Undefined());
+        args.push_back(obj);
+        args.push_back(RawValue(JoinedKeys[chunk]));
+        args.insert(args.end(), values + start, values + end);
+        void(helper.Invoke(args.data(), static_cast<unsigned int>(args.size())));
+    }
+}
+
+vector_view<string>^ JsObjectTemplateImpl::Keys::get()
+{
+    auto keys = ref new Platform::Collections::Vector<string^>(static_cast<unsigned int>(KeyNames.size()));
+    for (size_t i = 0; i < KeyNames.size(); i++)
+        keys->SetAt(static_cast<unsigned int>(i), ref new string(KeyNames[i].c_str(), static_cast<unsigned int>(KeyNames[i].length())));
+    return keys->GetView();
+}
+
+IJsObject^ JsObjectTemplateImpl::Instantiate(const array<IJsValue>^ values)
+{
+    NULL_CHECK(values);
+    if (values->Length != KeyNames.size())
+        Throw(E_INVALIDARG, L"values and keys of the template have different length.");
+    auto args = std::vector<RawValue>(values->Length + 1);
+    args[0] = RawValue::Undefined();
+    for (uint32 i = 0; i < values->Length; i++)
+        args[i + 1] = get_ref_or_undefined(values[i]);
+    const auto owner = GetOwner();
+    // the constructor is only cached for one context of the owner, others define properties one chunk per call.
+    if (owner != nullptr && owner->Handle == RawContext::Current().Runtime())
+    {
+        const auto constructor = GetConstructor();
+        if (constructor.IsValid())
+            return JsWrapperCache::Wrap<JsObjectImpl>(constructor.Invoke(args.data(), static_cast<unsigned int>(args.size())));
+    }
+    const auto obj = RawValue::CreateObject();
+    if (!KeyNames.empty())
+        DefineProperties(obj, args.data() + 1);
+    return JsWrapperCache::Wrap<JsObjectImpl>(obj);
+}
+
+IJsObjectTemplate^ JsObject::CreateTemplate(const array<string>^ keys)
+{
+    NULL_CHECK(keys);
+    auto names = std::vector<std::wstring>();
+    names.reserve(keys->Length);
+    for (const auto key : keys)
+    {
+        // keys are joined by '\0' for the DefineProperties helper.
+        if (std::wmemchr(key->Data(), L'\0', key->Length()) != nullptr)
+            Throw(E_INVALIDARG, L"Keys of the template can't contain '\\0'.");
+        names.emplace_back(key->Data(), key->Length());
+    }
+    return ref new JsObjectTemplateImpl(std::move(names));
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "JsObject.h"
+#include <vector>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// A template to create objects with the same set of properties.
+    /// </summary>
+    public interface class IJsObjectTemplate
+    {
+        /// <summary>
+        /// Gets names of properties of objects created by the template.
+        /// </summary>
+        DECL_R_PROPERTY(vector_view<string>^, Keys);
+
+        /// <summary>
+        /// Creates a new <see cref="IJsObject"/> with properties of the template.
+        /// </summary>
+        /// <param name="values">Values of properties, in the same order of <see cref="Keys"/>.</param>
+        /// <returns>A new <see cref="IJsObject"/> with properties.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        IJsObject^ Instantiate(const array<IJsValue>^ values);
+    };
+
+    ref class JsRuntime;
+
+    ref class JsObjectTemplateImpl sealed : [Default] IJsObjectTemplate
+    {
+    private:
+        ~JsObjectTemplateImpl();
+
+        const std::vector<std::wstring> KeyNames;
+        // Keys joined by '\0' in chunks fitting in a call of the DefineProperties helper, built on first use.
+        std::vector<std::wstring> JoinedKeys;
+        // Runtime of the current context on creation, Constructor is pinned in it.
+        weak_ref Owner;
+        // Function returning an object literal of the keys, compiled in ConstructorContext of Owner on first use.
+        RawValue Constructor;
+        RawContext ConstructorContext;
+
+        JsRuntime^ GetOwner();
+        RawValue GetConstructor();
+        void DefineProperties(const RawValue& obj, const RawValue* values);
+
+    internal:
+        JsObjectTemplateImpl(std::vector<std::wstring> keys);
+
+    public:
+        virtual DECL_R_PROPERTY(vector_view<string>^, Keys);
+        virtual IJsObject^ Instantiate(const array<IJsValue>^ values);
+    };
+}
@@ -0,0 +1,204 @@
+#pragma once
+#include "JsObject.h"
+#include "JsSymbol.h"
+#include <string>
+#include <unordered_map>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    template<typename TKey>
+    struct JsObjectViewTraits {};
+
+    template<>
+    struct JsObjectViewTraits<string>
+    {
+        static RawValue OwnKeys(const RawValue& obj) { return obj.ObjOwnPropertyNames(); }
+        using IndexKey = std::wstring;
+        static string^ ToKey(const RawValue& key) { return key.ToString(); }
+        static IndexKey ToIndexKey(const RawValue& key) { const auto str = key.ToString(); return IndexKey(str.Data(), str.Length()); }
+        static IndexKey ToIndexKey(string^ key) { return IndexKey(key->Data(), key->Length()); }
+    };
+
+    template<>
+    struct JsObjectViewTraits<IJsSymbol>
+    {
+        static RawValue OwnKeys(const RawValue& obj) { return obj.ObjOwnPropertySymbols(); }
+        // symbols are compared by reference, they are kept alive by the key array.
+        using IndexKey = RawValue;
+        static IJsSymbol^ ToKey(const RawValue& key) { return ref new JsSymbolImpl(key); }
+        static IndexKey ToIndexKey(const RawValue& key) { return key; }
+        static IndexKey ToIndexKey(IJsSymbol^ key) { NULL_CHECK(key); return get_ref(key); }
+    };
+
+    template<typename TKey>
+    ref class JsObjectViewImpl;
+
+    template<typename TKey>
+    ref class JsObjectViewPairImpl sealed : kv_pair<TKey, IJsValue>
+    {
+    internal:
+        JsObjectViewImpl<TKey>^const View;
+        const uint32 Index;
+        TKey^const PairKey;
+        IJsValue^ PairValue;
+
+        JsObjectViewPairImpl(JsObjectViewImpl<TKey>^const view, const uint32 index, TKey^const key)
+            : View(view), Index(index), PairKey(key) {}
+
+    public:
+        virtual property TKey^ Key { TKey^ get() { return PairKey; } }
+
+        virtual property IJsValue^ Value
+        {
+            IJsValue^ get()
+            {
+                if (PairValue == nullptr)
+                    PairValue = View->ValueAt(Index);
+                return PairValue;
+            }
+        }
+    };
+
+    template<typename TKey>
+    ref class JsObjectViewIteratorImpl sealed : iterator<kv_pair<TKey, IJsValue>>
+    {
+    internal:
+        using IKVP = kv_pair<TKey, IJsValue>;
+
+        JsObjectViewImpl<TKey>^const View;
+        uint32 Index;
+
+        JsObjectViewIteratorImpl(JsObjectViewImpl<TKey>^const view)
+            : View(view), Index(0) {}
+
+    public:
+        virtual property IKVP^ Current
+        {
+            IKVP^ get()
+            {
+                if (!HasCurrent)
+                    Throw(E_BOUNDS, L"The iterator has passed the end of the view.");
+                return ref new JsObjectViewPairImpl<TKey>(View, Index, View->KeyAt(Index));
+            }
+        }
+
+        virtual property bool HasCurrent { bool get() { return Index < View->Length; } }
+
+        virtual bool MoveNext()
+        {
+            if (HasCurrent)
+                Index++;
+            return HasCurrent;
+        }
+
+        virtual uint32 GetMany(write_only_array<IKVP>^ items)
+        {
+            NULL_CHECK(items);
+            uint32 count = 0;
+            for (; count < items->Length && HasCurrent; count++, Index++)
+                items[count] = Current;
+            return count;
+        }
+    };
+
+    /// <summary>
+    /// A view over own properties of an object, keys are captured on creation and values are fetched on access.
+    /// </summary>
+    /// <remarks>
+    /// Size, iteration, HasKey and Lookup all answer from the captured keys,
+    /// a captured key deleted later has the value <c>undefined</c>.
+    /// </remarks>
+    template<typename TKey>
+    ref class JsObjectViewImpl sealed : map_view<TKey, IJsValue>
+    {
+    internal:
+        using Traits = JsObjectViewTraits<TKey>;
+        using IKVP = kv_pair<TKey, IJsValue>;
+
+        JsObjectImpl^const Owner;
+        // wrapper of the key array, keeps it alive while the view is alive.
+        JsObjectImpl^const Keys;
+        // the view covers Keys[Begin, Begin + Length).
+        const uint32 Begin;
+        const uint32 Length;
+        // map from captured keys to their index in the view, built on first HasKey or Lookup.
+        std::unordered_map<typename Traits::IndexKey, uint32> KeyIndex;
+        bool KeyIndexBuilt;
+
+        JsObjectViewImpl(JsObjectImpl^const owner)
+            : Owner(owner)
+            , Keys(ref new JsObjectImpl(Traits::OwnKeys(owner->Reference)))
+            , Begin(0)
+            , Length(static_cast<uint32>(Keys->Reference[RawPropertyKey::length]().ToInt()))
+            , KeyIndexBuilt(false) {}
+
+        JsObjectViewImpl(JsObjectImpl^const owner, JsObjectImpl^const keys, const uint32 begin, const uint32 length)
+            : Owner(owner), Keys(keys), Begin(begin), Length(length), KeyIndexBuilt(false) {}
+
+        RawValue RawKeyAt(const uint32 index)
+        {
+            return Keys->Reference[RawValue(static_cast<int>(Begin + index))];
+        }
+
+        bool FindKey(TKey^ key, uint32* index)
+        {
+            if (!KeyIndexBuilt)
+            {
+                KeyIndex.reserve(Length);
+                for (uint32 i = 0; i < Length; i++)
+                    KeyIndex.emplace(Traits::ToIndexKey(RawKeyAt(i)), i);
+                KeyIndexBuilt = true;
+            }
+            const auto entry = KeyIndex.find(Traits::ToIndexKey(key));
+            if (entry == KeyIndex.end())
+                return false;
+            *index = entry->second;
+            return true;
+        }
+
+        TKey^ KeyAt(const uint32 index)
+        {
+            return Traits::ToKey(RawKeyAt(index));
+        }
+
+        IJsValue^ ValueAt(const uint32 index)
+        {
+            return JsValue::CreateTyped(Owner->Reference[RawKeyAt(index)]);
+        }
+
+    public:
+        virtual property uint32 Size { uint32 get() { return Length; } }
+
+        virtual bool HasKey(TKey^ key)
+        {
+            uint32 index;
+            return FindKey(key, &index);
+        }
+
+        virtual IJsValue^ Lookup(TKey^ key)
+        {
+            uint32 index;
+            if (!FindKey(key, &index))
+                Throw(E_BOUNDS, L"The key is not in the view.");
+            return ValueAt(index);
+        }
+
+        virtual void Split(map_view<TKey, IJsValue>^* first, map_view<TKey, IJsValue>^* second)
+        {
+            if (Length < 2)
+            {
+                *first = nullptr;
+                *second = nullptr;
+                return;
+            }
+            const auto half = Length / 2;
+            *first = ref new JsObjectViewImpl<TKey>(Owner, Keys, Begin, half);
+            *second = ref new JsObjectViewImpl<TKey>(Owner, Keys, Begin + half, Length - half);
+        }
+
+        virtual iterator<IKVP>^ First()
+        {
+            return ref new JsObjectViewIteratorImpl<TKey>(this);
+        }
+    };
+}
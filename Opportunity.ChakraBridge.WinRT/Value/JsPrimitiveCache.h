@@ -0,0 +1,137 @@
+#pragma once
+#include "JsUndefined.h"
+#include "JsNull.h"
+#include "JsBoolean.h"
+#include "JsNumber.h"
+#include <cmath>
+#include <vector>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Shared wrappers of primitive values of a context.
+    /// </summary>
+    /// <remarks>
+    /// Wrappers of <see langword="undefined"/>, <see langword="null"/>, <see langword="true"/>, <see langword="false"/>
+    /// and small integers are created on first use and reused while the context is alive.
+    /// </remarks>
+    struct JsPrimitiveCache sealed
+    {
+        explicit JsPrimitiveCache(const RawIntrinsicValues& intrinsics) : Intrinsics(intrinsics) {}
+        JsPrimitiveCache(const JsPrimitiveCache&) = delete;
+        JsPrimitiveCache& operator =(const JsPrimitiveCache&) = delete;
+
+        // Cache of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local JsPrimitiveCache* Current = nullptr;
+
+        // Integers in [MinSmallInt, MaxSmallInt] share wrappers, set MaxSmallInt below MinSmallInt to disable.
+        static constexpr int MinSmallInt = -128;
+        static constexpr int MaxSmallInt = 1023;
+
+        static JsUndefinedImpl^ Undefined(const RawValue& value)
+        {
+            const auto cache = Current;
+            if (cache == nullptr || value.Ref != cache->Intrinsics.Undefined)
+                return ref new JsUndefinedImpl(value);
+            return Share(cache->UndefinedInstance, value);
+        }
+
+        static JsNullImpl^ Null(const RawValue& value)
+        {
+            const auto cache = Current;
+            if (cache == nullptr || value.Ref != cache->Intrinsics.Null)
+                return ref new JsNullImpl(value);
+            return Share(cache->NullInstance, value);
+        }
+
+        static JsBooleanImpl^ Boolean(const RawValue& value)
+        {
+            const auto cache = Current;
+            if (cache != nullptr)
+            {
+                if (value.Ref == cache->Intrinsics.True)
+                    return Share(cache->TrueInstance, value);
+                if (value.Ref == cache->Intrinsics.False)
+                    return Share(cache->FalseInstance, value);
+            }
+            return ref new JsBooleanImpl(value);
+        }
+
+        static JsBooleanImpl^ Boolean(const bool value)
+        {
+            const auto cache = Current;
+            if (cache == nullptr)
+                return ref new JsBooleanImpl(RawValue(value));
+            return Boolean(value ? RawValue::True() : RawValue::False());
+        }
+
+        static JsNumberImpl^ Number(const RawValue& value)
+        {
+            const auto cache = Current;
+            if (cache == nullptr)
+                return ref new JsNumberImpl(value);
+            // JsNumberToInt truncates, but the slot is only reused for the same reference,
+            // so the number is checked to be the integer only when the slot is filled.
+            const auto integer = value.ToInt();
+            if (integer < MinSmallInt || integer > MaxSmallInt)
+                return ref new JsNumberImpl(value);
+            auto& slot = cache->SmallInt(integer);
+            if (slot != nullptr && slot->Reference == value)
+                return slot;
+            const auto number = value.ToDouble();
+            if (number != integer || (integer == 0 && std::signbit(number)))
+                return ref new JsNumberImpl(value);
+            slot = ref new JsNumberImpl(value);
+            return slot;
+        }
+
+        static JsNumberImpl^ Number(const int value)
+        {
+            const auto cache = Current;
+            if (cache == nullptr || value < MinSmallInt || value > MaxSmallInt)
+                return ref new JsNumberImpl(RawValue(value));
+            auto& slot = cache->SmallInt(value);
+            if (slot == nullptr)
+                slot = ref new JsNumberImpl(RawValue(value));
+            return slot;
+        }
+
+        /// <summary>
+        /// Drops all shared wrappers.
+        /// </summary>
+        void Clear()
+        {
+            if (Current == this)
+                Current = nullptr;
+            UndefinedInstance = nullptr;
+            NullInstance = nullptr;
+            TrueInstance = nullptr;
+            FalseInstance = nullptr;
+            SmallInts.clear();
+            SmallInts.shrink_to_fit();
+        }
+
+    private:
+        const RawIntrinsicValues& Intrinsics;
+        JsUndefinedImpl^ UndefinedInstance;
+        JsNullImpl^ NullInstance;
+        JsBooleanImpl^ TrueInstance;
+        JsBooleanImpl^ FalseInstance;
+        std::vector<JsNumberImpl^> SmallInts;
+
+        template<typename TImpl>
+        static TImpl^ Share(TImpl^& slot, const RawValue& value)
+        {
+            if (slot == nullptr)
+                slot = ref new TImpl(value);
+            return slot;
+        }
+
+        JsNumberImpl^& SmallInt(const int value)
+        {
+            if (SmallInts.empty())
+                SmallInts.resize(static_cast<size_t>(MaxSmallInt - MinSmallInt + 1));
+            return SmallInts[static_cast<size_t>(value - MinSmallInt)];
+        }
+    };
+}
@@ -0,0 +1,115 @@
+#include "pch.h"
+#include "JsStructCodec.h"
+#include "Native\BufferPointer.h"
+#include "Native\VectorKernels.h"
+#include <cstring>
+#include <limits>
+
+using namespace Opportunity::ChakraBridge::WinRT;
+
+// Typed arrays of fields are laid out one after another in the array buffer, with offsets aligned to it.
+constexpr uint64 FieldAlignment = 8;
+
+JsStructCodec::JsStructCodec(const array<JsStructField>^ fields, uint32 stride)
+    : RecordSize(stride)
+{
+    NULL_CHECK(fields);
+    if (stride == 0)
+        Throw(E_INVALIDARG, L"stride should be positive.");
+    FieldList.reserve(fields->Length);
+    for (uint32 i = 0; i < fields->Length; i++)
+    {
+        const auto field = fields[i];
+        const auto size = JsTypedArray::GetSize(field.Type);
+        if (field.Offset > stride || size > stride - field.Offset)
+            Throw(E_INVALIDARG, L"A field exceeds the record.");
+        FieldList.push_back(field);
+    }
+}
+
+uint32 JsStructCodec::Stride::get()
+{
+    return RecordSize;
+}
+
+array<IJsTypedArray>^ JsStructCodec::DecodeCore(const uint8* records, uint32 length)
+{
+    const auto count = length / RecordSize;
+    auto offsets = std::vector<uint32>(FieldList.size());
+    uint64 bufferLength = 0;
+    for (size_t i = 0; i < FieldList.size(); i++)
+    {
+        bufferLength = (bufferLength + FieldAlignment - 1) / FieldAlignment * FieldAlignment;
+        if (bufferLength > std::numeric_limits<uint32>::max())
+            Throw(E_INVALIDARG, L"records is too large.");
+        offsets[i] = static_cast<uint32>(bufferLength);
+        bufferLength += static_cast<uint64>(count) * JsTypedArray::GetSize(FieldList[i].Type);
+    }
+    if (bufferLength > std::numeric_limits<uint32>::max())
+        Throw(E_INVALIDARG, L"records is too large.");
+
+    // no script runs from here, records stays valid.
+    const auto buffer = JsWrapperCache::Wrap<JsArrayBufferImpl>(RawValue::CreateArrayBuffer(static_cast<uint32>(bufferLength)));
+    const auto storage = buffer->BufferPtr;
+    auto result = ref new array<IJsTypedArray>(static_cast<uint32>(FieldList.size()));
+    for (size_t i = 0; i < FieldList.size(); i++)
+    {
+        const auto& field = FieldList[i];
+        const auto size = JsTypedArray::GetSize(field.Type);
+        GatherElements(records + field.Offset, RecordSize, count, size, field.IsBigEndian, storage + offsets[i]);
+        const auto arr = RawValue::CreateTypedArray(field.Type, buffer->Reference, offsets[i], count);
+        result[static_cast<uint32>(i)] = JsWrapperCache::Wrap<JsTypedArrayImpl>(arr, [&arr] { return JsTypedArray::CreateTyped(arr); });
+    }
+    return result;
+}
+
+array<IJsTypedArray>^ JsStructCodec::Decode(IBuffer^ records)
+{
+    NULL_CHECK(records);
+    unsigned int length;
+    const auto data = GetPointerOfBuffer(records, &length);
+    return DecodeCore(data, length);
+}
+
+array<IJsTypedArray>^ JsStructCodec::Decode(IJsDataView^ records)
+{
+    NULL_CHECK(records);
+    const auto view = to_impl(records);
+    return DecodeCore(view->BufferPtr, view->BufferLen);
+}
+
+IBuffer^ JsStructCodec::Encode(const array<IJsTypedArray>^ fields)
+{
+    NULL_CHECK(fields);
+    if (fields->Length != FieldList.size())
+        Throw(E_INVALIDARG, L"Count of fields does not match the codec.");
+    auto arrays = std::vector<JsTypedArrayImpl^>(fields->Length);
+    uint32 count = 0;
+    for (uint32 i = 0; i < fields->Length; i++)
+    {
+        NULL_CHECK(fields[i]);
+        const auto arr = to_impl(fields[i]);
+        if (arr->ArrType != FieldList[i].Type)
+            Throw(E_INVALIDARG, L"Type of a field does not match the codec.");
+        const auto length = arr->ArraySize;
+        if (i == 0)
+            count = length;
+        else if (length != count)
+            Throw(E_INVALIDARG, L"Fields should have the same length.");
+        arrays[i] = arr;
+    }
+
+    const auto recordsLength = static_cast<uint64>(count) * RecordSize;
+    if (recordsLength > std::numeric_limits<uint32>::max())
+        Throw(E_INVALIDARG, L"fields is too large.");
+    const auto records = ref new Windows::Storage::Streams::Buffer(static_cast<uint32>(recordsLength));
+    records->Length = static_cast<uint32>(recordsLength);
+    const auto data = GetPointerOfBuffer(records);
+    std::memset(data, 0, static_cast<size_t>(recordsLength));
+    for (size_t i = 0; i < FieldList.size(); i++)
+    {
+        const auto& field = FieldList[i];
+        ScatterElements(arrays[i]->BufferPtr, count, arrays[i]->ElementSize, field.IsBigEndian, data + field.Offset, RecordSize);
+    }
+    return records;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "JsTypedArray.h"
+#include "JsDataView.h"
+#include <vector>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// A field of records of <see cref="JsStructCodec"/>.
+    /// </summary>
+    public value struct JsStructField
+    {
+        /// <summary>
+        /// Type of the field, also the type of the typed array of the field.
+        /// </summary>
+        JsArrayType Type;
+        /// <summary>
+        /// Offset of the field in a record, in bytes.
+        /// </summary>
+        uint32 Offset;
+        /// <summary>
+        /// Whether the field is stored in big endian, or in little endian otherwise.
+        /// </summary>
+        bool IsBigEndian;
+    };
+
+    /// <summary>
+    /// Converts records of fixed layout to typed arrays of fields, and back again.
+    /// </summary>
+    /// <remarks>
+    /// Typed arrays of fields created by <see cref="Decode"/> share one <see cref="IJsArrayBuffer"/>.
+    /// </remarks>
+    public ref class JsStructCodec sealed
+    {
+    private:
+        std::vector<JsStructField> FieldList;
+        const uint32 RecordSize;
+
+        array<IJsTypedArray>^ DecodeCore(const uint8* records, uint32 length);
+
+    public:
+        /// <summary>
+        /// Creates a new instance of <see cref="JsStructCodec"/>.
+        /// </summary>
+        /// <param name="fields">Fields of records.</param>
+        /// <param name="stride">Size of records in bytes, fields should not exceed it.</param>
+        JsStructCodec(const array<JsStructField>^ fields, uint32 stride);
+
+        /// <summary>
+        /// Size of records in bytes.
+        /// </summary>
+        property uint32 Stride { uint32 get(); }
+
+        /// <summary>
+        /// Converts records to typed arrays of fields.
+        /// </summary>
+        /// <param name="records">Records to convert, bytes after the last whole record are ignored.</param>
+        /// <returns>Typed arrays of fields, in the same order of fields.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        [DefaultOverload]
+        [Overload("DecodeBuffer")]
+        array<IJsTypedArray>^ Decode(IBuffer^ records);
+
+        /// <summary>
+        /// Converts records to typed arrays of fields.
+        /// </summary>
+        /// <param name="records">Records to convert, bytes after the last whole record are ignored.</param>
+        /// <returns>Typed arrays of fields, in the same order of fields.</returns>
+        /// <remarks>Requires an active script context.</remarks>
+        [Overload("DecodeDataView")]
+        array<IJsTypedArray>^ Decode(IJsDataView^ records);
+
+        /// <summary>
+        /// Converts typed arrays of fields to records.
+        /// </summary>
+        /// <param name="fields">Typed arrays of fields, in the same order and types of fields, with the same length.</param>
+        /// <returns>Records of the fields, bytes not covered by fields are zero.</returns>
+        IBuffer^ Encode(const array<IJsTypedArray>^ fields);
+    };
+}
@@ -49,7 +49,7 @@ RawValue GetSymbolProperty(const wchar_t* name)
 {
     try
     {
-        RawValue value = RawValue::GlobalObject()[L"Symbol"][name];
+        RawValue value = RawValue::GlobalObject()[RawPropertyKey::Symbol][name];
         auto valueType = value.Type();
         if (valueType != TExpacted)
             goto GET_FALLBACK;
@@ -61,7 +61,7 @@ RawValue GetSymbolProperty(const wchar_t* name)
     }
 GET_FALLBACK:
     const auto sym = RawValue::CreateSymbol(nullptr).ToJsObjet();
-    return sym[L"constructor"][name];
+    return sym[RawPropertyKey::constructor][name];
 }
 
 IJsSymbol^ JsSymbol::For(IJsValue^ key)
@@ -1,11 +1,25 @@
 #include "pch.h"
 #include "JsTypedArray.h"
+#include "JsTypedArrayView.h"
 #include "Native\NativeBuffer.h"
+#include <cmath>
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
-JsTypedArrayImpl::JsTypedArrayImpl(RawValue ref, uint8*const bufferPtr, const uint32 bufferLen, const JsArrayType arrType, const uint32 elementSize)
-    : JsObjectImpl(std::move(ref)), BufferPtr(bufferPtr), BufferLen(bufferLen), ArrType(arrType), ElementSize(elementSize) {}
+JsTypedArrayImpl::JsTypedArrayImpl(RawValue ref, const JsArrayType arrType, const uint32 elementSize)
+    : JsObjectImpl(std::move(ref)), ArrType(arrType), ElementSize(elementSize) {}
+
+uint8* JsTypedArrayImpl::BufferPtr::get()
+{
+    Storage.Fetch(Reference);
+    return Storage.Ptr;
+}
+
+uint32 JsTypedArrayImpl::BufferLen::get()
+{
+    Storage.Fetch(Reference);
+    return Storage.Len;
+}
 
 IJsArrayBuffer^ JsTypedArrayImpl::Buffer::get()
 {
@@ -57,16 +71,93 @@ void JsTypedArrayImpl::BoundCheck(uint32 index)
         Throw(E_INVALIDARG, L"index is larger than the size of the typed array.");
 }
 
+/// <summary>
+/// Calls <paramref name="func"/> with the storage of <paramref name="arr"/> as pointer to its elements and the count of them.
+/// </summary>
+template<typename TFunc>
+auto VisitElements(JsTypedArrayImpl^const arr, TFunc&& func)
+{
+    using AT = JsArrayType;
+    const auto ptr = arr->BufferPtr;
+    const auto count = static_cast<size_t>(arr->ArraySize);
+#define CASE(name) \
+    case AT::name: return func(reinterpret_cast<const typename JsTypedArrayTempInfo<AT::name>::t_ele*>(ptr), count)
+
+    switch (arr->ArrType)
+    {
+        CASE(Int8);
+        CASE(Uint8);
+        CASE(Uint8Clamped);
+        CASE(Int16);
+        CASE(Uint16);
+        CASE(Int32);
+        CASE(Uint32);
+        CASE(Float32);
+        CASE(Float64);
+    }
+#undef CASE
+    Throw(E_NOTIMPL, L"Unknown array type.");
+}
+
+float64 JsTypedArrayImpl::Sum()
+{
+    return VisitElements(this, [](const auto data, const size_t count)
+    {
+        return SumElements(data, count);
+    });
+}
+
+float64 JsTypedArrayImpl::Min()
+{
+    return VisitElements(this, [](const auto data, const size_t count)
+    {
+        std::remove_const_t<std::remove_pointer_t<decltype(data)>> min, max;
+        if (!MinMaxElements(data, count, &min, &max))
+            return std::numeric_limits<float64>::quiet_NaN();
+        return static_cast<float64>(min);
+    });
+}
+
+float64 JsTypedArrayImpl::Max()
+{
+    return VisitElements(this, [](const auto data, const size_t count)
+    {
+        std::remove_const_t<std::remove_pointer_t<decltype(data)>> min, max;
+        if (!MinMaxElements(data, count, &min, &max))
+            return std::numeric_limits<float64>::quiet_NaN();
+        return static_cast<float64>(max);
+    });
+}
+
+float64 JsTypedArrayImpl::Mean()
+{
+    const auto count = ArraySize;
+    if (count == 0)
+        return std::numeric_limits<float64>::quiet_NaN();
+    return Sum() / count;
+}
+
+array<uint32>^ JsTypedArrayImpl::Histogram(float64 lowerBound, float64 upperBound, uint32 binCount)
+{
+    if (binCount == 0)
+        Throw(E_INVALIDARG, L"binCount should be positive.");
+    if (!std::isfinite(lowerBound) || !std::isfinite(upperBound) || !(lowerBound < upperBound))
+        Throw(E_INVALIDARG, L"lowerBound and upperBound should be finite, and lowerBound should be less than upperBound.");
+    const auto bins = ref new array<uint32>(binCount);
+    VisitElements(this, [=](const auto data, const size_t count)
+    {
+        HistogramElements(data, count, lowerBound, upperBound, bins->Data, binCount);
+    });
+    return bins;
+}
+
 JsTypedArrayImpl^ JsTypedArray::CreateTyped(RawValue ref)
 {
     using AT = JsArrayType;
-    uint8* bufferPtr;
-    unsigned int bufferLen;
     AT arrType;
-    int elementSize;
-    CHAKRA_CALL(JsGetTypedArrayStorage(ref.Ref, &bufferPtr, &bufferLen, reinterpret_cast<::JsTypedArrayType*>(&arrType), &elementSize));
+    CHAKRA_CALL(JsGetTypedArrayInfo(ref.Ref, reinterpret_cast<::JsTypedArrayType*>(&arrType), nullptr, nullptr, nullptr));
 #define CASE(name) \
-    case AT::name: return ref new JsTypedArrayTempImpl<AT::name>(ref, bufferPtr, bufferLen, arrType, static_cast<unsigned int>(elementSize))
+    case AT::name: return ref new JsTypedArrayTempImpl<AT::name>(ref, arrType, sizeof(typename JsTypedArrayTempInfo<AT::name>::t_ele))
 
     switch (arrType)
     {
@@ -84,7 +175,7 @@ JsTypedArrayImpl^ JsTypedArray::CreateTyped(RawValue ref)
     Throw(E_NOTIMPL, L"Unknown array type.");
 }
 
-uint32 GetSize(JsArrayType arrType)
+uint32 JsTypedArray::GetSize(JsArrayType arrType)
 {
     using AT = JsArrayType;
 
@@ -107,12 +198,14 @@ uint32 GetSize(JsArrayType arrType)
 
 IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType)
 {
-    return CreateTyped(RawValue::CreateTypedArray(arrayType, nullptr, 0, 0));
+    const auto r = RawValue::CreateTypedArray(arrayType, nullptr, 0, 0);
+    return JsWrapperCache::Wrap<JsTypedArrayImpl>(r, [&r] { return CreateTyped(r); });
 }
 
 IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, uint32 length)
 {
-    return CreateTyped(RawValue::CreateTypedArray(arrayType, nullptr, 0, length));
+    const auto r = RawValue::CreateTypedArray(arrayType, nullptr, 0, length);
+    return JsWrapperCache::Wrap<JsTypedArrayImpl>(r, [&r] { return CreateTyped(r); });
 }
 
 IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, IJsValue^ arrayLike)
@@ -121,7 +214,8 @@ IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, IJsValue^ arrayLike)
     auto ref = to_impl(arrayLike)->Reference;
     if (dynamic_cast<IJsObject^>(arrayLike) == nullptr)
         ref = ref.ToJsObjet();
-    return CreateTyped(RawValue::CreateTypedArray(arrayType, ref, 0, 0));
+    const auto r = RawValue::CreateTypedArrayFrom(arrayType, ref);
+    return JsWrapperCache::Wrap<JsTypedArrayImpl>(r, [&r] { return CreateTyped(r); });
 }
 
 IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, IJsArrayBuffer^ buffer)
@@ -138,5 +232,6 @@ IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, IJsArrayBuffer^ buffe
 IJsTypedArray^ JsTypedArray::Create(JsArrayType arrayType, IJsArrayBuffer^ buffer, uint32 byteOffset, uint32 length)
 {
     NULL_CHECK(buffer);
-    return CreateTyped(RawValue::CreateTypedArray(arrayType, to_impl(buffer)->Reference, byteOffset, length));
+    const auto r = RawValue::CreateTypedArray(arrayType, to_impl(buffer)->Reference, byteOffset, length);
+    return JsWrapperCache::Wrap<JsTypedArrayImpl>(r, [&r] { return CreateTyped(r); });
 }
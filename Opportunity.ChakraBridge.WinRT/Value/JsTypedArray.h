@@ -2,6 +2,7 @@
 #define NOMINMAX
 #include "JsObject.h"
 #include "JsEnum.h"
+#include "Native\VectorKernels.h"
 #include <unordered_map>
 
 namespace Opportunity::ChakraBridge::WinRT
@@ -14,6 +15,10 @@ namespace Opportunity::ChakraBridge::WinRT
         /// <summary>
         /// A <see cref="Windows::Storage::Streams::IBuffer"/> to access data of this <see cref="IJsTypedArray"/>.
         /// </summary>
+        /// <remarks>
+        /// Requires an active script context to get, the buffer can be read and written on any thread afterwards,
+        /// while no script of the runtime detaches the array.
+        /// </remarks>
         DECL_R_PROPERTY(IBuffer^, Data);
         /// <summary>
         /// Gets the type of array.
@@ -35,17 +40,50 @@ namespace Opportunity::ChakraBridge::WinRT
         /// Represents the offset (in bytes) of this <see cref="IJsTypedArray"/> from the start of its <see cref="Buffer"/>.
         /// </summary>
         DECL_R_PROPERTY(uint32, ByteOffset);
+
+        /// <summary>
+        /// Gets the sum of elements.
+        /// </summary>
+        /// <returns>The sum of elements, or 0 if the array is empty.</returns>
+        float64 Sum();
+        /// <summary>
+        /// Gets the smallest element, <c>NaN</c> elements are ignored.
+        /// </summary>
+        /// <returns>The smallest element, or <c>NaN</c> if there is no element to compare.</returns>
+        float64 Min();
+        /// <summary>
+        /// Gets the largest element, <c>NaN</c> elements are ignored.
+        /// </summary>
+        /// <returns>The largest element, or <c>NaN</c> if there is no element to compare.</returns>
+        float64 Max();
+        /// <summary>
+        /// Gets the arithmetic mean of elements.
+        /// </summary>
+        /// <returns>The mean of elements, or <c>NaN</c> if the array is empty.</returns>
+        float64 Mean();
+        /// <summary>
+        /// Counts elements in equal width bins.
+        /// </summary>
+        /// <param name="lowerBound">Lower bound of the first bin.</param>
+        /// <param name="upperBound">Upper bound of the last bin, elements equal to it are counted in the last bin.</param>
+        /// <param name="binCount">Count of bins.</param>
+        /// <returns>Counts of elements in each bin, elements out of the bounds and <c>NaN</c> are not counted.</returns>
+        array<uint32>^ Histogram(float64 lowerBound, float64 upperBound, uint32 binCount);
     };
 
     ref class JsTypedArrayImpl abstract : JsObjectImpl, [Default] IJsTypedArray
     {
+    private:
+        RawStorage<JsType::TypedArray> Storage;
+
     internal:
-        uint8 * const BufferPtr;
-        const uint32 BufferLen;
         const JsArrayType ArrType;
         const uint32 ElementSize;
 
-        JsTypedArrayImpl(RawValue ref, uint8*const bufferPtr, const uint32 bufferLen, const JsArrayType arrType, const uint32 elementSize);
+        property uint8* BufferPtr { uint8* get(); }
+        property uint32 BufferLen { uint32 get(); }
+
+        JsTypedArrayImpl(RawValue ref, const JsArrayType arrType, const uint32 elementSize);
 
         INHERIT_INTERFACE_R_PROPERTY(Type, JsType, IJsValue);
         INHERIT_INTERFACE_R_PROPERTY(Context, JsContext^, IJsValue);
@@ -56,6 +94,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
@@ -84,6 +128,11 @@ namespace Opportunity::ChakraBridge::WinRT
         virtual DECL_R_PROPERTY(uint32, BytesPerElement);
         virtual DECL_R_PROPERTY(uint32, ByteLength);
         virtual DECL_R_PROPERTY(uint32, ByteOffset);
+        virtual float64 Sum();
+        virtual float64 Min();
+        virtual float64 Max();
+        virtual float64 Mean();
+        virtual array<uint32>^ Histogram(float64 lowerBound, float64 upperBound, uint32 binCount);
     };
 
     /// <summary>
@@ -96,6 +145,8 @@ namespace Opportunity::ChakraBridge::WinRT
 
     internal:
         static JsTypedArrayImpl^ CreateTyped(RawValue ref);
+        // Size of elements of the array type in bytes.
+        static uint32 GetSize(JsArrayType arrType);
 
     public:
         /// <summary>
@@ -163,32 +214,163 @@ namespace Opportunity::ChakraBridge::WinRT
     template<JsArrayType EEle>
     struct JsTypedArrayTempInfo {};
 
-#define __TYPED_ARRAY_INTERFACE_DECL(name, actualType, rtType) \
-    public interface class IJs##name##Array :IJsTypedArray, vector<rtType>{}; \
+// Doc comments can not be expanded from macros, so members of the interfaces are written out.
+#define __TYPED_ARRAY_INTERFACE_DECL(name, rtType) \
+    public interface class IJs##name##Array :IJsTypedArray, vector<rtType>
+#define __TYPED_ARRAY_INTERFACE_INFO(name, actualType, rtType) \
     template<>struct JsTypedArrayTempInfo<JsArrayType::name>{using t_ele = actualType;using t_winrt = rtType; using t_int = IJs##name##Array;}
 
     /// <summary>A Javascript Int8Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Int8, int8, int16);
+    __TYPED_ARRAY_INTERFACE_DECL(Int8, int16)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Each item must be in -128 ~ 127 and is not wrapped as <c>Int8Array.prototype.set</c> would do, otherwise the call throws <c>E_INVALIDARG</c> without writing any item.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<int16>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Int8, int8, int16);
+
     /// <summary>A Javascript Uint8Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Uint8, uint8, uint8);
+    __TYPED_ARRAY_INTERFACE_DECL(Uint8, uint8)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>uint8</c> fits in the element type, items are written as is.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<uint8>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Uint8, uint8, uint8);
+
     /// <summary>A Javascript Uint8ClampedArray.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Uint8Clamped, uint8, uint8);
+    __TYPED_ARRAY_INTERFACE_DECL(Uint8Clamped, uint8)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>uint8</c> fits in the element type, items are written as is and no clamping is involved.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<uint8>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Uint8Clamped, uint8, uint8);
+
     /// <summary>A Javascript Int16Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Int16, int16, int16);
+    __TYPED_ARRAY_INTERFACE_DECL(Int16, int16)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>int16</c> fits in the element type, items are written as is.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<int16>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Int16, int16, int16);
+
     /// <summary>A Javascript Uint16Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Uint16, uint16, uint16);
+    __TYPED_ARRAY_INTERFACE_DECL(Uint16, uint16)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>uint16</c> fits in the element type, items are written as is.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<uint16>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Uint16, uint16, uint16);
+
     /// <summary>A Javascript Int32Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Int32, int32, int32);
+    __TYPED_ARRAY_INTERFACE_DECL(Int32, int32)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>int32</c> fits in the element type, items are written as is.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<int32>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Int32, int32, int32);
+
     /// <summary>A Javascript Uint32Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Uint32, uint32, uint32);
+    __TYPED_ARRAY_INTERFACE_DECL(Uint32, uint32)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Every <c>uint32</c> fits in the element type, items are written as is.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<uint32>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Uint32, uint32, uint32);
+
     /// <summary>A Javascript Float32Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Float32, float32, float32);
+    __TYPED_ARRAY_INTERFACE_DECL(Float32, float32)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Items are written as is, including NaN and infinities.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<float32>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Float32, float32, float32);
+
     /// <summary>A Javascript Float64Array.</summary>
-    __TYPED_ARRAY_INTERFACE_DECL(Float64, float64, float64);
+    __TYPED_ARRAY_INTERFACE_DECL(Float64, float64)
+    {
+        /// <summary>
+        /// Writes items to the array from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">Index of the first item to write.</param>
+        /// <param name="items">Items to write.</param>
+        /// <remarks>
+        /// Items are written as is, including NaN and infinities.
+        /// If the items do not fit in the array from <paramref name="startIndex"/>, the call throws <c>E_INVALIDARG</c> without writing.
+        /// </remarks>
+        void SetMany(uint32 startIndex, const array<float64>^ items);
+    };
+    __TYPED_ARRAY_INTERFACE_INFO(Float64, float64, float64);
 
+#undef __TYPED_ARRAY_INTERFACE_INFO
 #undef __TYPED_ARRAY_INTERFACE_DECL
 #pragma pop_macro("interface")
 
+    template<typename TAct, typename TRt>
+    ref class JsTypedArrayViewImpl;
+
     template<JsArrayType EEle,
         typename TAct = typename JsTypedArrayTempInfo<EEle>::t_ele,
         typename TRt = typename JsTypedArrayTempInfo<EEle>::t_winrt,
@@ -196,8 +378,8 @@ namespace Opportunity::ChakraBridge::WinRT
     ref class JsTypedArrayTempImpl sealed : JsTypedArrayImpl, [Default] TInterface
     {
     internal:
-        JsTypedArrayTempImpl(RawValue ref, uint8*const bufferPtr, const uint32 bufferLen, const JsArrayType arrType, const uint32 elementSize)
-            :JsTypedArrayImpl(std::move(ref), bufferPtr, bufferLen, arrType, elementSize)
+        JsTypedArrayTempImpl(RawValue ref, const JsArrayType arrType, const uint32 elementSize)
+            :JsTypedArrayImpl(std::move(ref), arrType, elementSize)
         {
             static_assert(std::numeric_limits<TRt>::max() >= std::numeric_limits<TAct>::max());
             static_assert(std::numeric_limits<TRt>::min() <= std::numeric_limits<TAct>::min());
@@ -217,6 +399,12 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_METHOD(PreventExtension, void, IJsObject);
         INHERIT_INTERFACE_R_PROPERTY(IsExtensionAllowed, bool, IJsObject);
         INHERIT_INTERFACE_RW_PROPERTY(ObjectCollectingCallback, JsOBCC^, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(GetProperties, array<IJsValue>^, IJsObject, const array<string>^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperties, void, IJsObject, const array<string>^, const array<IJsValue>^);
+        INHERIT_INTERFACE_RW_PROPERTY(KeySnapshotEnabled, bool, IJsObject);
+        INHERIT_INTERFACE_METHOD(Refresh, void, IJsObject);
+        INHERIT_INTERFACE_METHOD_PARAM1(InsertMany, void, IJsObject, IStrMapView^);
+        INHERIT_INTERFACE_METHOD_PARAM2(SetProperty, void, IJsObject, string^, IJsValue^);
 
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, IStrMap, string^);
         INHERIT_INTERFACE_METHOD_PARAM1(Lookup, IJsValue^, ISymMap, IJsSymbol^);
@@ -241,33 +429,66 @@ namespace Opportunity::ChakraBridge::WinRT
         INHERIT_INTERFACE_R_PROPERTY(BytesPerElement, uint32, IJsTypedArray);
         INHERIT_INTERFACE_R_PROPERTY(ByteLength, uint32, IJsTypedArray);
         INHERIT_INTERFACE_R_PROPERTY(ByteOffset, uint32, IJsTypedArray);
+        INHERIT_INTERFACE_METHOD(Sum, float64, IJsTypedArray);
+        INHERIT_INTERFACE_METHOD(Min, float64, IJsTypedArray);
+        INHERIT_INTERFACE_METHOD(Max, float64, IJsTypedArray);
+        INHERIT_INTERFACE_METHOD(Mean, float64, IJsTypedArray);
+        INHERIT_INTERFACE_METHOD_PARAM3(Histogram, array<uint32>^, IJsTypedArray, float64, float64, uint32);
 
         INHERIT_INTERFACE_R_PROPERTY_EXPLICT(Size, ArraySize, uint32, vector<TRt>);
 
+        [[noreturn]] static void ThrowForElementRange()
+        {
+            std::wstringstream stream;
+            stream << L"value is too large of too small for the element in this tyepd array, a value in range of "
+                << std::numeric_limits<TAct>::min() << " ~ " << std::numeric_limits<TAct>::max() << " is expected.";
+            auto str = stream.str();
+            Throw(E_INVALIDARG, string_ref(str.c_str(), str.length()));
+        }
+
         static TAct InElementCheck(TRt value)
         {
             if constexpr(std::numeric_limits<TRt>::max() != std::numeric_limits<TAct>::max()
                 || std::numeric_limits<TRt>::min() != std::numeric_limits<TAct>::min())
             {
                 if (value > std::numeric_limits<TAct>::max() || value < std::numeric_limits<TAct>::min())
-                {
-                    std::wstringstream stream;
-                    stream << L"value is too large of too small for the element in this tyepd array, a value in range of "
-                        << std::numeric_limits<TAct>::min() << " ~ " << std::numeric_limits<TAct>::max() << " is expected.";
-                    auto str = stream.str();
-                    Throw(E_INVALIDARG, string_ref(str.c_str(), str.length()));
-                }
+                    ThrowForElementRange();
             }
             return static_cast<TAct>(value);
         }
 
+        // Checks all items before writing, the array is not changed if any of them is out of range.
+        void StoreElements(const uint32 startIndex, const TRt* items, const uint32 count)
+        {
+            if (!ElementsInRange<TAct>(items, count))
+                ThrowForElementRange();
+            NarrowElements(items, count, reinterpret_cast<TAct*>(BufferPtr) + startIndex);
+        }
+
     public:
         virtual void Append(TRt value) { ThrowForFixedSize(); }
         virtual void ArrayClear() = vector<TRt>::Clear{ ThrowForFixedSize(); }
         virtual void InsertAt(uint32 index, TRt value) { ThrowForFixedSize(); }
         virtual void RemoveAt(uint32 index) { ThrowForFixedSize(); }
         virtual void RemoveAtEnd() { ThrowForFixedSize(); }
-        virtual void ReplaceAll(const array<TRt>^ items) { ThrowForFixedSize(); }
+
+        virtual void ReplaceAll(const array<TRt>^ items)
+        {
+            const auto length = items == nullptr ? 0u : items->Length;
+            if (length != ArraySize)
+                ThrowForFixedSize();
+            if (length != 0)
+                StoreElements(0, items->Data, length);
+        }
+
+        virtual void SetMany(uint32 startIndex, const array<TRt>^ items)
+        {
+            NULL_CHECK(items);
+            const auto size = ArraySize;
+            if (startIndex > size || items->Length > size - startIndex)
+                Throw(E_INVALIDARG, L"items is out of the range of the typed array.");
+            StoreElements(startIndex, items->Data, items->Length);
+        }
 
         virtual TRt GetAt(uint32 index)
         {
@@ -280,7 +501,7 @@ namespace Opportunity::ChakraBridge::WinRT
             NULL_CHECK(items);
             BoundCheck(startIndex);
             auto end = static_cast<uint32>(std::min(static_cast<uint64>(startIndex) + items->Length, static_cast<uint64>(ArraySize)));
-            std::copy_n(reinterpret_cast<TAct*>(BufferPtr) + startIndex, end - startIndex, items->begin());
+            WidenElements(reinterpret_cast<TAct*>(BufferPtr) + startIndex, end - startIndex, items->Data);
             return end - startIndex;
         }
 
@@ -288,11 +509,11 @@ namespace Opportunity::ChakraBridge::WinRT
         {
             const auto actualValue = InElementCheck(value);
             const auto first = reinterpret_cast<TAct*>(BufferPtr);
-            const auto last = first + ArraySize;
-            auto p = std::find(first, last, actualValue);
-            if (p == last)
+            const auto size = ArraySize;
+            const auto p = FindElement(first, size, actualValue);
+            if (p == size)
                 return false;
-            *index = static_cast<uint32>(p - first);
+            *index = static_cast<uint32>(p);
             return true;
         }
 
@@ -304,8 +525,7 @@ namespace Opportunity::ChakraBridge::WinRT
 
         virtual vector_view<TRt>^ ArrayGetView() = vector<TRt>::GetView
         {
-            auto vec = std::vector<TRt>(reinterpret_cast<TAct*>(BufferPtr), reinterpret_cast<TAct*>(BufferPtr) + ArraySize);
-            return ref new Platform::Collections::VectorView<TRt>(std::move(vec));
+            return ref new JsTypedArrayViewImpl<TAct, TRt>(this);
         }
 
         virtual iterator<TRt>^ ArrayFirst() = vector<TRt>::First{ return ArrayGetView()->First(); }
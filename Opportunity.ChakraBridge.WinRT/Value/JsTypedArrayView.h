@@ -0,0 +1,114 @@
+#pragma once
+#include "JsTypedArray.h"
+#include <algorithm>
+#include <limits>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    template<typename TAct, typename TRt>
+    ref class JsTypedArrayIteratorImpl;
+
+    /// <summary>
+    /// A view reads the storage of a typed array directly, the typed array is kept alive by the view.
+    /// </summary>
+    /// <remarks>
+    /// The storage is fetched when the view is created, so the view can be read without a current context,
+    /// such as by a <c>foreach</c> after the context scope ends, with the storage fetched last.
+    /// </remarks>
+    template<typename TAct, typename TRt>
+    ref class JsTypedArrayViewImpl sealed : vector_view<TRt>
+    {
+    internal:
+        JsTypedArrayImpl^const Owner;
+        const uint32 Length;
+
+        // getting ArraySize fetches the storage of the owner, which needs a current context.
+        JsTypedArrayViewImpl(JsTypedArrayImpl^const owner)
+            : Owner(owner), Length(owner->ArraySize) {}
+
+        /// <summary>
+        /// Gets storage of the owner, throws if the owner has been detached.
+        /// </summary>
+        const TAct* Storage()
+        {
+            if (Owner->ArraySize < Length)
+                Throw(E_CHANGED_STATE, L"The typed array of the view has been detached.");
+            return reinterpret_cast<const TAct*>(Owner->BufferPtr);
+        }
+
+    public:
+        virtual property uint32 Size { uint32 get() { return Length; } }
+
+        virtual TRt GetAt(uint32 index)
+        {
+            if (index >= Length)
+                Throw(E_BOUNDS, L"index is larger than the size of the view.");
+            return Storage()[index];
+        }
+
+        virtual uint32 GetMany(uint32 startIndex, write_only_array<TRt>^ items)
+        {
+            NULL_CHECK(items);
+            if (startIndex >= Length)
+                return 0;
+            const auto count = std::min(items->Length, Length - startIndex);
+            WidenElements(Storage() + startIndex, count, items->Data);
+            return count;
+        }
+
+        virtual bool IndexOf(TRt value, uint32* index)
+        {
+            NULL_CHECK(index);
+            if (value > std::numeric_limits<TAct>::max() || value < std::numeric_limits<TAct>::lowest())
+                return false;
+            const auto p = FindElement(Storage(), Length, static_cast<TAct>(value));
+            if (p == Length)
+                return false;
+            *index = static_cast<uint32>(p);
+            return true;
+        }
+
+        virtual iterator<TRt>^ First()
+        {
+            return ref new JsTypedArrayIteratorImpl<TAct, TRt>(this);
+        }
+    };
+
+    template<typename TAct, typename TRt>
+    ref class JsTypedArrayIteratorImpl sealed : iterator<TRt>
+    {
+    internal:
+        JsTypedArrayViewImpl<TAct, TRt>^const View;
+        uint32 Index;
+
+        JsTypedArrayIteratorImpl(JsTypedArrayViewImpl<TAct, TRt>^const view)
+            : View(view), Index(0) {}
+
+    public:
+        virtual property TRt Current
+        {
+            TRt get()
+            {
+                if (!HasCurrent)
+                    Throw(E_BOUNDS, L"The iterator has passed the end of the view.");
+                return View->GetAt(Index);
+            }
+        }
+
+        virtual property bool HasCurrent { bool get() { return Index < View->Length; } }
+
+        virtual bool MoveNext()
+        {
+            if (HasCurrent)
+                Index++;
+            return HasCurrent;
+        }
+
+        virtual uint32 GetMany(write_only_array<TRt>^ items)
+        {
+            const auto count = View->GetMany(Index, items);
+            Index += count;
+            return count;
+        }
+    };
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsUndefined.h"
+#include "JsPrimitiveCache.h"
 
 using namespace Opportunity::ChakraBridge::WinRT;
 
@@ -10,6 +11,6 @@ string^ JsUndefinedImpl::ToString() { return L"undefined"; }
 
 IJsUndefined^ JsUndefined::Instance::get()
 {
-    return ref new JsUndefinedImpl(RawValue::Undefined());
+    return JsPrimitiveCache::Undefined(RawValue::Undefined());
 }
 
@@ -27,24 +27,10 @@ JsType JsValueImpl::Type::get()
     return Reference.Type();
 }
 
-JsValueImpl^ JsValue::CreateTyped(RawValue ref)
+JsObjectImpl^ JsValue::CreateObject(const RawValue& ref, const JsType type)
 {
-    if (!ref.IsValid())
-        return nullptr;
-    switch (ref.Type())
+    switch (type)
     {
-    case JsType::Undefined:
-        return ref new JsUndefinedImpl(ref);
-    case JsType::Null:
-        return ref new JsNullImpl(ref);
-    case JsType::Number:
-        return ref new JsNumberImpl(ref);
-    case JsType::String:
-        return ref new JsStringImpl(ref);
-    case JsType::Boolean:
-        return ref new JsBooleanImpl(ref);
-    case JsType::Symbol:
-        return ref new JsSymbolImpl(ref);
     case JsType::Object:
         if (ref.ObjHasExternalData())
             return ref new JsExternalObjectImpl(ref);
@@ -66,6 +52,29 @@ JsValueImpl^ JsValue::CreateTyped(RawValue ref)
     return ref new JsObjectImpl(ref);
 }
 
+JsValueImpl^ JsValue::CreateTyped(RawValue ref)
+{
+    if (!ref.IsValid())
+        return nullptr;
+    const auto type = ref.Type();
+    switch (type)
+    {
+    case JsType::Undefined:
+        return JsPrimitiveCache::Undefined(ref);
+    case JsType::Null:
+        return JsPrimitiveCache::Null(ref);
+    case JsType::Number:
+        return JsPrimitiveCache::Number(ref);
+    case JsType::String:
+        return ref new JsStringImpl(ref);
+    case JsType::Boolean:
+        return JsPrimitiveCache::Boolean(ref);
+    case JsType::Symbol:
+        return ref new JsSymbolImpl(ref);
+    }
+    return JsWrapperCache::Wrap<JsObjectImpl>(ref, [&ref, type] { return CreateObject(ref, type); });
+}
+
 bool JsValue::ReferenceEquals(IJsValue^ v1, IJsValue^ v2)
 {
     if (v1 == nullptr)
@@ -82,7 +91,7 @@ bool JsValue::Equals(IJsValue^ v1, IJsValue^ v2)
     if (v2 == nullptr)
         return false;
     bool r;
-    CHAKRA_CALL(JsEquals(to_impl(v1)->Reference.Ref, to_impl(v2)->Reference.Ref, &r));
+    CHAKRA_SCRIPT_CALL(JsEquals(to_impl(v1)->Reference.Ref, to_impl(v2)->Reference.Ref, &r));
     return r;
 }
 
@@ -109,7 +118,7 @@ IJsBoolean^ JsValue::ToJsBoolean(IJsValue^ value)
     auto cv = dynamic_cast<IJsBoolean^>(value);
     if (cv != nullptr)
         return cv;
-    return ref new JsBooleanImpl(to_impl(value)->Reference.ToJsBoolean());
+    return JsPrimitiveCache::Boolean(to_impl(value)->Reference.ToJsBoolean());
 }
 
 IJsNumber^ JsValue::ToJsNumber(IJsValue^ value)
@@ -118,7 +127,10 @@ IJsNumber^ JsValue::ToJsNumber(IJsValue^ value)
     auto cv = dynamic_cast<IJsNumber^>(value);
     if (cv != nullptr)
         return cv;
-    return ref new JsNumberImpl(to_impl(value)->Reference.ToJsNumber());
+    const auto& reference = to_impl(value)->Reference;
+    if (dynamic_cast<IJsObject^>(value) == nullptr)
+        return JsPrimitiveCache::Number(reference.PrimitiveToJsNumber());
+    return JsPrimitiveCache::Number(reference.ToJsNumber());
 }
 
 IJsString^ JsValue::ToJsString(IJsValue^ value)
@@ -127,7 +139,10 @@ IJsString^ JsValue::ToJsString(IJsValue^ value)
     auto cv = dynamic_cast<IJsString^>(value);
     if (cv != nullptr)
         return cv;
-    return ref new JsStringImpl(to_impl(value)->Reference.ToJsString());
+    const auto& reference = to_impl(value)->Reference;
+    if (dynamic_cast<IJsObject^>(value) == nullptr)
+        return ref new JsStringImpl(reference.PrimitiveToJsString());
+    return ref new JsStringImpl(reference.ToJsString());
 }
 
 IJsObject^ JsValue::ToJsObject(IJsValue^ value)
@@ -141,5 +156,5 @@ IJsObject^ JsValue::ToJsObject(IJsValue^ value)
 
 IJsObject^ JsValue::GlobalObject::get()
 {
-    return ref new JsObjectImpl(RawValue::GlobalObject());
+    return JsWrapperCache::Wrap<JsObjectImpl>(RawValue::GlobalObject());
 }
@@ -60,6 +60,7 @@ namespace Opportunity::ChakraBridge::WinRT
         JsValue() {}
     internal:
         static JsValueImpl^ CreateTyped(RawValue ref);
+        static JsObjectImpl^ CreateObject(const RawValue& ref, const JsType type);
     public:
         /// <summary>
         /// Gets the global object in the current script context.
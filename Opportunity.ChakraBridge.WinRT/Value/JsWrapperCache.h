@@ -0,0 +1,109 @@
+#pragma once
+#include "JsObject.h"
+#include <unordered_map>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Projected wrappers of objects of a context, referenced weakly.
+    /// </summary>
+    /// <remarks>
+    /// Disabled by default, since each cached object needs a before-collect callback.
+    /// An entry is removed by the before-collect callback of its object, dead entries of live objects are
+    /// replaced on next crossing.
+    /// </remarks>
+    struct JsWrapperCache sealed
+    {
+        JsWrapperCache() = default;
+        JsWrapperCache(const JsWrapperCache&) = delete;
+        JsWrapperCache& operator =(const JsWrapperCache&) = delete;
+
+        // Cache of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local JsWrapperCache* Current = nullptr;
+
+        bool Enabled = false;
+
+        /// <summary>
+        /// Gets the live wrapper of the object, or <see langword="nullptr"/>.
+        /// </summary>
+        JsObjectImpl^ Find(const RawValue& ref) const
+        {
+            const auto entry = Wrappers.find(ref);
+            if (entry == Wrappers.end())
+                return nullptr;
+            return entry->second.Resolve<JsObjectImpl>();
+        }
+
+        /// <summary>
+        /// Adds the wrapper, ignored if the object is cached by another context.
+        /// </summary>
+        void Add(JsObjectImpl^const wrapper)
+        {
+            if (wrapper->RegisterWrapperCache(this))
+                Wrappers[wrapper->Reference] = wrapper;
+        }
+
+        void Remove(const RawValue& ref)
+        {
+            Wrappers.erase(ref);
+        }
+
+        /// <summary>
+        /// Gets the wrapper of the object from the cache of current context, or creates one by <paramref name="create"/> and adds it.
+        /// </summary>
+        /// <remarks>
+        /// All wrappers of objects should be created through this, so that an object has one wrapper in a context.
+        /// </remarks>
+        template<typename TImpl, typename TCreate>
+        static TImpl^ Wrap(const RawValue& ref, const TCreate& create)
+        {
+            const auto cache = Current;
+            if (cache == nullptr || !cache->Enabled)
+                return create();
+            if (const auto cached = dynamic_cast<TImpl^>(cache->Find(ref)))
+                return cached;
+            TImpl^const wrapper = create();
+            cache->Add(wrapper);
+            return wrapper;
+        }
+
+        /// <summary>
+        /// Gets the wrapper of the object from the cache of current context, or creates a <typeparamref name="TImpl"/> and adds it.
+        /// </summary>
+        template<typename TImpl>
+        static TImpl^ Wrap(const RawValue& ref)
+        {
+            return Wrap<TImpl>(ref, [&ref]() -> TImpl^ { return ref new TImpl(ref); });
+        }
+
+        /// <summary>
+        /// Drops all entries and detaches the cache from the objects.
+        /// </summary>
+        void Clear()
+        {
+            if (Current == this)
+                Current = nullptr;
+            Detach();
+        }
+
+        /// <summary>
+        /// Enables or disables the cache, entries are dropped when disabled.
+        /// </summary>
+        void SetEnabled(const bool value)
+        {
+            if (!value)
+                Detach();
+            Enabled = value;
+        }
+
+    private:
+        std::unordered_map<RawValue, weak_ref> Wrappers;
+
+        void Detach()
+        {
+            for (const auto& entry : Wrappers)
+                JsObjectImpl::UnregisterWrapperCache(entry.first, this);
+            Wrappers.clear();
+        }
+    };
+}
@@ -10,6 +10,7 @@ namespace Opportunity::ChakraBridge::WinRT
     interface class IJsString;
     interface class IJsBoolean;
     interface class IJsObject;
+    interface class IJsObjectTemplate;
     interface class IJsExternalObject;
     interface class IJsFunction;
     interface class IJsError;
@@ -26,6 +27,7 @@ namespace Opportunity::ChakraBridge::WinRT
     ref class JsStringImpl;
     ref class JsBooleanImpl;
     ref class JsObjectImpl;
+    ref class JsObjectTemplateImpl;
     ref class JsExternalObjectImpl;
     ref class JsFunctionImpl;
     ref class JsErrorImpl;
@@ -2,7 +2,12 @@
 #include "RawRuntime.h"
 #include "RawContext.h"
 #include "RawPropertyId.h"
+#include "RawPropertyIdTable.h"
+#include "RawIntrinsicValues.h"
+#include "RawStorageGeneration.h"
+#include "RawStorage.h"
 #include "RawValue.h"
+#include "RawHelperFunctions.h"
 #include <sstream>
 
 namespace Opportunity::ChakraBridge::WinRT
@@ -31,6 +36,9 @@ namespace Opportunity::ChakraBridge::WinRT
     {
         try
         {
+            // script ran before the callback and may run again after it, storage fetched
+            // outside of the callback is not trusted, nor is storage fetched inside of it.
+            const RawStorageGeneration::Scope scope;
             const auto caller = (argumentCount == 0 || arguments[0] == JS_INVALID_REFERENCE)
                 ? GlobalObject()
                 : RawValue(arguments[0]);
@@ -69,7 +69,7 @@ namespace Opportunity::ChakraBridge::WinRT
         static RawValue RunScript(const wchar_t*const script, const JsSourceContext sourceContext, const wchar_t *sourceUrl)
         {
             RawValue r;
-            CHAKRA_CALL(JsRunScript(script, sourceContext, sourceUrl, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsRunScript(script, sourceContext, sourceUrl, &r.Ref));
             return r;
         }
 
@@ -80,7 +80,7 @@ namespace Opportunity::ChakraBridge::WinRT
             const wchar_t *const sourceUrl)
         {
             RawValue r;
-            CHAKRA_CALL(JsRunSerializedScript(script, buffer, sourceContext, sourceUrl, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsRunSerializedScript(script, buffer, sourceContext, sourceUrl, &r.Ref));
             return r;
         }
 
@@ -92,7 +92,7 @@ namespace Opportunity::ChakraBridge::WinRT
             const wchar_t *const sourceUrl)
         {
             RawValue r;
-            CHAKRA_CALL(JsRunSerializedScriptWithCallback(scriptLoadCallback, scriptUnloadCallback, buffer, sourceContext, sourceUrl, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsRunSerializedScriptWithCallback(scriptLoadCallback, scriptUnloadCallback, buffer, sourceContext, sourceUrl, &r.Ref));
             return r;
         }
 
@@ -0,0 +1,137 @@
+#pragma once
+#include "PreDeclear.h"
+#include "RawValue.h"
+#include "RawContext.h"
+#include <array>
+
+// Script helpers used by bulk operations of the implementations, compiled once per context.
+// Helpers that capture built-ins are compiled when the context is created, before any script can patch them.
+#define RAW_HELPER_FUNCTIONS(HELPER)                                                                                          \
+    /* (target, keys, ...values): keys are joined by '\0', assigns values[i] to target[keys[i]] with strict rules. */       \
+    HELPER(AssignProperties, L"(function(o,k){'use strict';k=k.split('\\0');for(var i=0;i<k.length;i++)o[k[i]]=arguments[i+2];return o;})") \
+    /* (target, keys, ...values): keys are joined by '\0', defines target[keys[i]] as a data property like an object literal. */ \
+    HELPER(DefineProperties, L"(function(d){return function(o,k){k=k.split('\\0');for(var i=0;i<k.length;i++)d(o,k[i],{__proto__:null,value:arguments[i+2],writable:true,enumerable:true,configurable:true});return o;};})(Object.defineProperty)") \
+    /* (target, keys): keys is an array, deletes target[keys[i]], non-configurable properties are skipped. */             \
+    HELPER(DeleteProperties, L"(function(o,k){for(var i=0;i<k.length;i++)delete o[k[i]];return o;})") \
+    /* (target, start, ...values): assigns values[i] to target[start + i]. */                                              \
+    HELPER(SetItems, L"(function(a,s){for(var i=2;i<arguments.length;i++)a[s+i-2]=arguments[i];return a;})")            \
+    /* this: target, (...values): the original push, appends values to target. */                                          \
+    HELPER(PushItems, L"Array.prototype.push")                                                                             \
+    /* (target, start, ...values): inserts values at target[start] with the original splice. */                            \
+    HELPER(InsertItems, L"(function(p,c){return function(a,s){var x=c.call(arguments);x[0]=s;x[1]=0;p.apply(a,x);return a;};})(Array.prototype.splice,Array.prototype.slice)") \
+    /* (target, start, count): removes count items from target[start] with the original splice. */                        \
+    HELPER(RemoveItems, L"(function(p){return function(a,s,n){p.call(a,s,n);return a;};})(Array.prototype.splice)") \
+    /* (target, start, end, receiver): calls receiver with target[start] to target[end - 1] as arguments. */               \
+    HELPER(GetItems, L"(function(s,p){return function(a,b,e,f){p.call(f,null,s.call(a,b,e));return a;};})(Array.prototype.slice,Function.prototype.apply)")
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    enum class RawHelperFunction : unsigned int
+    {
+#define HELPER(name, source) name,
+        RAW_HELPER_FUNCTIONS(HELPER)
+#undef HELPER
+    };
+
+    constexpr size_t RawHelperFunctionCount = 0
+#define HELPER(name, source) + 1
+        RAW_HELPER_FUNCTIONS(HELPER)
+#undef HELPER
+        ;
+
+    constexpr const wchar_t* RawHelperFunctionSource(const RawHelperFunction helper)
+    {
+        constexpr const wchar_t* sources[] =
+        {
+#define HELPER(name, source) source,
+            RAW_HELPER_FUNCTIONS(HELPER)
+#undef HELPER
+        };
+        return sources[static_cast<size_t>(helper)];
+    }
+
+    /// <summary>
+    /// Compiled helper functions of a context, pinned with <c>JsAddRef</c> while the context is alive.
+    /// </summary>
+    struct RawHelperFunctions sealed
+    {
+        RawHelperFunctions() = default;
+        RawHelperFunctions(const RawHelperFunctions&) = delete;
+        RawHelperFunctions& operator =(const RawHelperFunctions&) = delete;
+
+        // Helpers of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local RawHelperFunctions* Current = nullptr;
+
+        /// <summary>
+        /// Compiles the helpers that capture built-ins, requires the context to be current.
+        /// </summary>
+        void Resolve()
+        {
+            constexpr RawHelperFunction capturing[] =
+            {
+                RawHelperFunction::DefineProperties,
+                RawHelperFunction::PushItems,
+                RawHelperFunction::InsertItems,
+                RawHelperFunction::RemoveItems,
+                RawHelperFunction::GetItems,
+            };
+            for (const auto helper : capturing)
+                Get(helper);
+        }
+
+        /// <summary>
+        /// Gets the helper, compiles it on first use, requires the context to be current.
+        /// </summary>
+        RawValue Get(const RawHelperFunction helper)
+        {
+            auto& function = Functions[static_cast<size_t>(helper)];
+            if (!function.IsValid())
+            {
+                const auto compiled = Compile(helper);
+                compiled.AddRef();
+                function = compiled;
+            }
+            return function;
+        }
+
+        static RawValue Lookup(const RawHelperFunction helper)
+        {
+            const auto helpers = Current;
+            if (helpers == nullptr)
+                return Compile(helper);
+            return helpers->Get(helper);
+        }
+
+        /// <summary>
+        /// Unpins all helpers.
+        /// </summary>
+        void Release()
+        {
+            for (const auto& function : Functions)
+            {
+                // ignore error.
+                if (function.IsValid())
+                    JsRelease(function.Ref, nullptr);
+            }
+            Clear();
+        }
+
+        /// <summary>
+        /// Drops all helpers without unpinning, for contexts whose runtime has been disposed.
+        /// </summary>
+        void Clear()
+        {
+            if (Current == this)
+                Current = nullptr;
+            Functions.fill(nullptr);
+        }
+
+    private:
+        std::array<RawValue, RawHelperFunctionCount> Functions;
+
+        static RawValue Compile(const RawHelperFunction helper)
+        {
+            return RawContext::RunScript(RawHelperFunctionSource(helper), JS_SOURCE_CONTEXT_NONE, L"");
+        }
+    };
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include "PreDeclear.h"
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Singleton values of a context, pinned with <c>JsAddRef</c> while the context is alive.
+    /// </summary>
+    struct RawIntrinsicValues sealed
+    {
+        RawIntrinsicValues() = default;
+        RawIntrinsicValues(const RawIntrinsicValues&) = delete;
+        RawIntrinsicValues& operator =(const RawIntrinsicValues&) = delete;
+
+        // Values of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local const RawIntrinsicValues* Current = nullptr;
+
+        JsValueRef GlobalObject = JS_INVALID_REFERENCE;
+        JsValueRef Undefined = JS_INVALID_REFERENCE;
+        JsValueRef Null = JS_INVALID_REFERENCE;
+        JsValueRef True = JS_INVALID_REFERENCE;
+        JsValueRef False = JS_INVALID_REFERENCE;
+
+        /// <summary>
+        /// Gets and pins all values, requires the context to be current.
+        /// </summary>
+        void Resolve()
+        {
+            JsValueRef values[5];
+            CHAKRA_CALL(JsGetGlobalObject(&values[0]));
+            CHAKRA_CALL(JsGetUndefinedValue(&values[1]));
+            CHAKRA_CALL(JsGetNullValue(&values[2]));
+            CHAKRA_CALL(JsGetTrueValue(&values[3]));
+            CHAKRA_CALL(JsGetFalseValue(&values[4]));
+            for (const auto value : values)
+                CHAKRA_CALL(JsAddRef(value, nullptr));
+            GlobalObject = values[0];
+            Undefined = values[1];
+            Null = values[2];
+            True = values[3];
+            False = values[4];
+        }
+
+        /// <summary>
+        /// Unpins all values.
+        /// </summary>
+        void Release()
+        {
+            for (const auto value : { GlobalObject, Undefined, Null, True, False })
+            {
+                // ignore error.
+                if (value != JS_INVALID_REFERENCE)
+                    JsRelease(value, nullptr);
+            }
+            Clear();
+        }
+
+        /// <summary>
+        /// Drops all values without unpinning, for contexts whose runtime has been disposed.
+        /// </summary>
+        void Clear()
+        {
+            if (Current == this)
+                Current = nullptr;
+            GlobalObject = Undefined = Null = True = False = JS_INVALID_REFERENCE;
+        }
+    };
+};
@@ -0,0 +1,180 @@
+#pragma once
+#include "PreDeclear.h"
+#include "RawPropertyId.h"
+#include "RawPropertyKey.h"
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    template<typename T>
+    constexpr bool is_wide_c_str_v = !std::is_array_v<T> && std::is_convertible_v<T, const wchar_t*>;
+
+    /// <summary>
+    /// Interned property ids of a runtime, for <see cref="RawPropertyKey"/> and string literals of the implementations.
+    /// </summary>
+    /// <remarks>
+    /// Ids in the table are pinned with <c>JsAddRef</c> until <see cref="Release()"/> is called before disposing the runtime,
+    /// names are keyed by the string storage of the pinned ids, so no copy is made.
+    /// Other names are resolved on each lookup and never interned.
+    /// </remarks>
+    struct RawPropertyIdTable sealed
+    {
+        RawPropertyIdTable() = default;
+        RawPropertyIdTable(const RawPropertyIdTable&) = delete;
+        RawPropertyIdTable(RawPropertyIdTable&&) = delete;
+        RawPropertyIdTable& operator =(const RawPropertyIdTable&) = delete;
+        RawPropertyIdTable& operator =(RawPropertyIdTable&&) = delete;
+
+        // Table of the runtime of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local RawPropertyIdTable* Current = nullptr;
+
+        // Literals stop being interned after the table reaches this size.
+        static constexpr size_t MaxNames = 4096;
+
+        RawPropertyId Get(const wchar_t*const name, const size_t length) const
+        {
+            const auto entry = Names.find(std::wstring_view(name, length));
+            if (entry != Names.end())
+                return entry->second;
+            return RawPropertyId(name);
+        }
+
+        template<size_t Len>
+        RawPropertyId Get(const wchar_t(&name)[Len])
+        {
+            const auto entry = Literals.find(name);
+            if (entry != Literals.end())
+            {
+                const auto& interned = entry->second;
+                if (interned.first.size() == Len - 1 && std::char_traits<wchar_t>::compare(interned.first.data(), name, Len - 1) == 0)
+                    return interned.second;
+                // not a literal, the array has been reused.
+                return Get(name, std::char_traits<wchar_t>::length(name));
+            }
+            const auto length = std::char_traits<wchar_t>::length(name);
+            const auto interned = Pin(name, length);
+            if (!interned)
+                return RawPropertyId(name);
+            if (length == Len - 1)
+                Literals.emplace(name, *interned);
+            return interned->second;
+        }
+
+        RawPropertyId Get(const RawPropertyKey key)
+        {
+            auto& id = Keys[static_cast<size_t>(key)];
+            if (!id.IsValid())
+            {
+                const auto name = RawPropertyKeyName(key);
+                const auto interned = Pin(name, std::char_traits<wchar_t>::length(name));
+                if (!interned)
+                    return RawPropertyId(name);
+                id = interned->second;
+            }
+            return id;
+        }
+
+        bool HasKeys() const
+        {
+            return Keys.back().IsValid();
+        }
+
+        /// <summary>
+        /// Resolves all slots of <see cref="RawPropertyKey"/>, requires an active script context of the runtime.
+        /// </summary>
+        void ResolveKeys()
+        {
+            for (size_t i = 0; i < RawPropertyKeyCount; i++)
+                void(Get(static_cast<RawPropertyKey>(i)));
+        }
+
+        /// <summary>
+        /// Unpins all ids, requires the runtime not to be disposed.
+        /// </summary>
+        void Release()
+        {
+            for (const auto& entry : Names)
+            {
+                // ignore error.
+                JsRelease(entry.second.Ref, nullptr);
+            }
+            Clear();
+        }
+
+        /// <summary>
+        /// Drops all entries without unpinning.
+        /// </summary>
+        void Clear()
+        {
+            if (Current == this)
+                Current = nullptr;
+            Keys.fill(nullptr);
+            Literals.clear();
+            Names.clear();
+        }
+
+        static RawPropertyId Lookup(const wchar_t*const name)
+        {
+            const auto table = Current;
+            if (table == nullptr)
+                return RawPropertyId(name);
+            return table->Get(name, std::char_traits<wchar_t>::length(name));
+        }
+
+        static RawPropertyId Lookup(const wchar_t*const name, const size_t length)
+        {
+            const auto table = Current;
+            if (table == nullptr)
+                return RawPropertyId(name);
+            return table->Get(name, length);
+        }
+
+        template<size_t Len>
+        static RawPropertyId Lookup(const wchar_t(&name)[Len])
+        {
+            const auto table = Current;
+            if (table == nullptr)
+                return RawPropertyId(name);
+            return table->Get(name);
+        }
+
+        static RawPropertyId Lookup(const RawPropertyKey key)
+        {
+            const auto table = Current;
+            if (table == nullptr)
+                return RawPropertyId(RawPropertyKeyName(key));
+            return table->Get(key);
+        }
+
+    private:
+        using Interned = std::pair<std::wstring_view, RawPropertyId>;
+
+        std::array<RawPropertyId, RawPropertyKeyCount> Keys;
+        std::unordered_map<std::wstring_view, RawPropertyId> Names;
+        std::unordered_map<const wchar_t*, Interned> Literals;
+
+        std::wstring_view Intern(const RawPropertyId& id)
+        {
+            const auto name = std::wstring_view(id.Name());
+            if (Names.emplace(name, id).second)
+                void(id.AddRef());
+            return name;
+        }
+
+        // Same as Get, but returns the interned entry, or nothing if the table is full.
+        std::optional<Interned> Pin(const wchar_t*const name, const size_t length)
+        {
+            const auto entry = Names.find(std::wstring_view(name, length));
+            if (entry != Names.end())
+                return *entry;
+            if (Names.size() >= MaxNames)
+                return std::nullopt;
+            const auto id = RawPropertyId(name);
+            return Interned(Intern(id), id);
+        }
+    };
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include "PreDeclear.h"
+
+// Well-known property names used by the implementations, resolved once per runtime.
+#define RAW_PROPERTY_KEYS(KEY) \
+    KEY(Array)                 \
+    KEY(Symbol)                \
+    KEY(buffer)                \
+    KEY(byteOffset)            \
+    KEY(constructor)           \
+    KEY(indexOf)               \
+    KEY(length)                \
+    KEY(message)               \
+    KEY(name)                  \
+    KEY(pop)                   \
+    KEY(prototype)             \
+    KEY(push)                  \
+    KEY(splice)                \
+    KEY(stack)
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    enum class RawPropertyKey : unsigned int
+    {
+#define KEY(name) name,
+        RAW_PROPERTY_KEYS(KEY)
+#undef KEY
+    };
+
+    constexpr size_t RawPropertyKeyCount = 0
+#define KEY(name) + 1
+        RAW_PROPERTY_KEYS(KEY)
+#undef KEY
+        ;
+
+    constexpr const wchar_t* RawPropertyKeyName(const RawPropertyKey key)
+    {
+        constexpr const wchar_t* names[] =
+        {
+#define KEY(name) _CRT_WIDE(_CRT_STRINGIZE(name)),
+            RAW_PROPERTY_KEYS(KEY)
+#undef KEY
+        };
+        return names[static_cast<size_t>(key)];
+    }
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include "PreDeclear.h"
+#include "JsEnum.h"
+#include "RawValue.h"
+#include "RawStorageGeneration.h"
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Cached storage of an ArrayBuffer, a typed array or a DataView.
+    /// </summary>
+    /// <remarks>
+    /// Storage is fetched on first access, and fetched again after script has run.
+    /// Without a current context, such as on a worker thread of async I/O, the storage fetched last is used,
+    /// so the first access needs a context.
+    /// </remarks>
+    template<JsType type>
+    struct RawStorage sealed
+    {
+        static_assert(type == JsType::ArrayBuffer || type == JsType::TypedArray || type == JsType::DataView);
+
+        uint8* Ptr = nullptr;
+        unsigned int Len = 0;
+        // RawStorageGeneration of Ptr and Len, 0 if not fetched.
+        uint64 Stamp = 0;
+
+        void Fetch(const RawValue& value)
+        {
+            const auto generation = RawStorageGeneration::Get();
+            if (generation == 0 ? Stamp != 0 : Stamp == generation)
+                return;
+            if constexpr (type == JsType::ArrayBuffer)
+                CHAKRA_CALL(JsGetArrayBufferStorage(value.Ref, &Ptr, &Len));
+            else if constexpr (type == JsType::TypedArray)
+                CHAKRA_CALL(JsGetTypedArrayStorage(value.Ref, &Ptr, &Len, nullptr, nullptr));
+            else
+                CHAKRA_CALL(JsGetDataViewStorage(value.Ref, &Ptr, &Len));
+            Stamp = generation;
+        }
+    };
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "PreDeclear.h"
+#include <atomic>
+
+// Calls a hosting API that may run script, such as functions, getters, setters or proxy traps,
+// the storage generation of current runtime is advanced around the call.
+#define CHAKRA_SCRIPT_CALL(expr) \
+do{\
+    const ::Opportunity::ChakraBridge::WinRT::RawStorageGeneration::Scope __scope;\
+    CHAKRA_CALL(expr);\
+}while (false)
+
+namespace Opportunity::ChakraBridge::WinRT
+{
+    /// <summary>
+    /// Generation of storage of array buffers in a runtime, advanced by operations that may run script.
+    /// </summary>
+    /// <remarks>
+    /// Cached storage pointers are valid while the generation is not changed, they should be fetched again otherwise.
+    /// A runtime is used by one thread at a time, so the generation is not synchronized.
+    /// </remarks>
+    struct RawStorageGeneration sealed
+    {
+        RawStorageGeneration()
+            // generations of different runtimes never collide, a stamp of a disposed runtime is never valid again.
+            : Value((static_cast<uint64>(NextRuntime.fetch_add(1, std::memory_order_relaxed)) << 40) | 1) {}
+        RawStorageGeneration(const RawStorageGeneration&) = delete;
+        RawStorageGeneration& operator =(const RawStorageGeneration&) = delete;
+
+        // Generation of runtime of current context on this thread, maintained by JsContext::Current.
+        static inline thread_local RawStorageGeneration* Current = nullptr;
+
+        /// <summary>
+        /// Gets the generation of current runtime, 0 if there is no current runtime, which can be used for storage not fetched.
+        /// </summary>
+        static uint64 Get() noexcept
+        {
+            const auto current = Current;
+            return current == nullptr ? 0 : current->Value;
+        }
+
+        static void Advance() noexcept
+        {
+            const auto current = Current;
+            if (current != nullptr)
+                current->Value++;
+        }
+
+        /// <summary>
+        /// Advances the generation on entering and leaving, for calls that may run script.
+        /// </summary>
+        /// <remarks>
+        /// Storage fetched by native callbacks while the script is running is also dropped after the call.
+        /// </remarks>
+        struct[[nodiscard]] Scope sealed
+        {
+            Scope() noexcept { Advance(); }
+            ~Scope() { Advance(); }
+            Scope(const Scope&) = delete;
+            Scope& operator =(const Scope&) = delete;
+        };
+
+    private:
+        uint64 Value;
+        static inline std::atomic<uint32> NextRuntime{ 1 };
+    };
+}
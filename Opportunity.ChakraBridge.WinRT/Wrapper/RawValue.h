@@ -2,6 +2,9 @@
 #include "PreDeclear.h"
 #include "RawRef.h"
 #include "RawPropertyId.h"
+#include "RawPropertyIdTable.h"
+#include "RawIntrinsicValues.h"
+#include "RawStorageGeneration.h"
 #include <cstring>
 #include <string>
 
@@ -22,6 +25,9 @@ namespace Opportunity::ChakraBridge::WinRT
 
         static RawValue GlobalObject()
         {
+            const auto intrinsics = RawIntrinsicValues::Current;
+            if (intrinsics != nullptr && intrinsics->GlobalObject != JS_INVALID_REFERENCE)
+                return RawValue(intrinsics->GlobalObject);
             RawValue g;
             CHAKRA_CALL(JsGetGlobalObject(&g.Ref));
             return g;
@@ -29,6 +35,9 @@ namespace Opportunity::ChakraBridge::WinRT
 
         static RawValue Null()
         {
+            const auto intrinsics = RawIntrinsicValues::Current;
+            if (intrinsics != nullptr && intrinsics->Null != JS_INVALID_REFERENCE)
+                return RawValue(intrinsics->Null);
             RawValue g;
             CHAKRA_CALL(JsGetNullValue(&g.Ref));
             return g;
@@ -36,6 +45,9 @@ namespace Opportunity::ChakraBridge::WinRT
 
         static RawValue Undefined()
         {
+            const auto intrinsics = RawIntrinsicValues::Current;
+            if (intrinsics != nullptr && intrinsics->Undefined != JS_INVALID_REFERENCE)
+                return RawValue(intrinsics->Undefined);
             RawValue g;
             CHAKRA_CALL(JsGetUndefinedValue(&g.Ref));
             return g;
@@ -43,6 +55,9 @@ namespace Opportunity::ChakraBridge::WinRT
 
         static RawValue True()
         {
+            const auto intrinsics = RawIntrinsicValues::Current;
+            if (intrinsics != nullptr && intrinsics->True != JS_INVALID_REFERENCE)
+                return RawValue(intrinsics->True);
             RawValue g;
             CHAKRA_CALL(JsGetTrueValue(&g.Ref));
             return g;
@@ -50,6 +65,9 @@ namespace Opportunity::ChakraBridge::WinRT
 
         static RawValue False()
         {
+            const auto intrinsics = RawIntrinsicValues::Current;
+            if (intrinsics != nullptr && intrinsics->False != JS_INVALID_REFERENCE)
+                return RawValue(intrinsics->False);
             RawValue g;
             CHAKRA_CALL(JsGetFalseValue(&g.Ref));
             return g;
@@ -149,6 +167,14 @@ namespace Opportunity::ChakraBridge::WinRT
             return r;
         }
 
+        // elements of the array-like object are read with [[Get]], which may run script.
+        static RawValue CreateTypedArrayFrom(const JsArrayType type, const RawValue& arrayLike)
+        {
+            RawValue r;
+            CHAKRA_SCRIPT_CALL(JsCreateTypedArray(static_cast<::JsTypedArrayType>(type), arrayLike.Ref, 0, 0, &r.Ref));
+            return r;
+        }
+
 #define CREATE_ERROR(methodName, implName)                  \
 static RawValue methodName(const RawValue& message)         \
 {                                                           \
@@ -214,6 +240,14 @@ static RawValue methodName(const RawValue& message)         \
         }
 
         RawValue ToJsNumber() const
+        {
+            RawValue r;
+            CHAKRA_SCRIPT_CALL(JsConvertValueToNumber(Ref, &r.Ref));
+            return r;
+        }
+
+        // for primitive values, which are converted without running script.
+        RawValue PrimitiveToJsNumber() const
         {
             RawValue r;
             CHAKRA_CALL(JsConvertValueToNumber(Ref, &r.Ref));
@@ -221,6 +255,14 @@ static RawValue methodName(const RawValue& message)         \
         }
 
         RawValue ToJsString() const
+        {
+            RawValue r;
+            CHAKRA_SCRIPT_CALL(JsConvertValueToString(Ref, &r.Ref));
+            return r;
+        }
+
+        // for primitive values, which are converted without running script.
+        RawValue PrimitiveToJsString() const
         {
             RawValue r;
             CHAKRA_CALL(JsConvertValueToString(Ref, &r.Ref));
@@ -307,46 +349,46 @@ static RawValue methodName(const RawValue& message)         \
 
         void ObjPreventExtension() const
         {
-            CHAKRA_CALL(JsPreventExtension(Ref));
+            CHAKRA_SCRIPT_CALL(JsPreventExtension(Ref));
         }
 
         bool ObjIsExtensionAllowed() const
         {
             bool r;
-            CHAKRA_CALL(JsGetExtensionAllowed(Ref, &r));
+            CHAKRA_SCRIPT_CALL(JsGetExtensionAllowed(Ref, &r));
             return r;
         }
 
         RawValue ObjProto() const
         {
             RawValue r;
-            CHAKRA_CALL(JsGetPrototype(Ref, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsGetPrototype(Ref, &r.Ref));
             return r;
         }
 
         void ObjProto(const RawValue& value) const
         {
-            CHAKRA_CALL(JsSetPrototype(Ref, value.Ref));
+            CHAKRA_SCRIPT_CALL(JsSetPrototype(Ref, value.Ref));
         }
 
         bool ObjInstanceOf(const RawValue& constructor) const
         {
             bool r;
-            CHAKRA_CALL(JsInstanceOf(Ref, constructor.Ref, &r));
+            CHAKRA_SCRIPT_CALL(JsInstanceOf(Ref, constructor.Ref, &r));
             return r;
         }
 
         RawValue ObjOwnPropertyNames() const
         {
             RawValue r;
-            CHAKRA_CALL(JsGetOwnPropertyNames(Ref, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsGetOwnPropertyNames(Ref, &r.Ref));
             return r;
         }
 
         RawValue ObjOwnPropertySymbols() const
         {
             RawValue r;
-            CHAKRA_CALL(JsGetOwnPropertySymbols(Ref, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsGetOwnPropertySymbols(Ref, &r.Ref));
             return r;
         }
 
@@ -389,14 +431,14 @@ static RawValue methodName(const RawValue& message)         \
         RawValue New(const RawValue*callerAndArgs, unsigned int len) const
         {
             RawValue r;
-            CHAKRA_CALL(JsConstructObject(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(callerAndArgs)), len, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsConstructObject(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(callerAndArgs)), len, &r.Ref));
             return r;
         }
 
         [[maybe_unused]]RawValue Invoke(const RawValue*callerAndArgs, unsigned int len) const
         {
             RawValue r;
-            CHAKRA_CALL(JsCallFunction(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(callerAndArgs)), len, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsCallFunction(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(callerAndArgs)), len, &r.Ref));
             return r;
         }
 
@@ -416,7 +458,7 @@ static RawValue methodName(const RawValue& message)         \
         {
             RawValue argsv;
             RawValue r;
-            CHAKRA_CALL(JsConstructObject(Ref, reinterpret_cast<JsValueRef*>(&argsv), 1, &r.Ref));
+            CHAKRA_SCRIPT_CALL(JsConstructObject(Ref, reinterpret_cast<JsValueRef*>(&argsv), 1, &r.Ref));
             return r;
         }
 
@@ -425,7 +467,7 @@ static RawValue methodName(const RawValue& message)         \
             if (caller.IsValid())
             {
                 RawValue r;
-                CHAKRA_CALL(JsCallFunction(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(&caller)), 1, &r.Ref));
+                CHAKRA_SCRIPT_CALL(JsCallFunction(Ref, reinterpret_cast<JsValueRef*>(const_cast<RawValue*>(&caller)), 1, &r.Ref));
                 return r;
             }
             return Invoke(RawValue::GlobalObject());
@@ -472,22 +514,32 @@ static RawValue methodName(const RawValue& message)         \
             operator RawValue() const
             {
                 RawValue r;
-                CHAKRA_CALL(JsGetProperty(Parent, PropIdRef, &r.Ref));
+                CHAKRA_SCRIPT_CALL(JsGetProperty(Parent, PropIdRef, &r.Ref));
                 return r;
             }
             PropertyStub& operator =(const RawValue & value)
             {
-                CHAKRA_CALL(JsSetProperty(Parent, PropIdRef, value.Ref, true));
+                CHAKRA_SCRIPT_CALL(JsSetProperty(Parent, PropIdRef, value.Ref, true));
                 return *this;
             }
             const PropertyStub& operator =(const RawValue & value) const
             {
-                CHAKRA_CALL(JsSetProperty(Parent, PropIdRef, value.Ref, true));
+                CHAKRA_SCRIPT_CALL(JsSetProperty(Parent, PropIdRef, value.Ref, true));
                 return *this;
             }
-            PropertyStub operator[](const wchar_t*const key) const
+            template<size_t Len>
+            PropertyStub operator[](const wchar_t(&key)[Len]) const
             {
-                return PropertyStub(RawValue(*this), key);
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(key));
+            }
+            template<typename TStr, typename = std::enable_if_t<is_wide_c_str_v<TStr>>>
+            PropertyStub operator[](const TStr& key) const
+            {
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(static_cast<const wchar_t*>(key)));
+            }
+            PropertyStub operator[](const RawPropertyKey key) const
+            {
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(key));
             }
             PropertyStub operator[](const RawPropertyId& key) const
             {
@@ -500,25 +552,25 @@ static RawValue methodName(const RawValue& message)         \
             [[nodiscard]] bool Exist() const
             {
                 bool r;
-                CHAKRA_CALL(JsHasProperty(Parent, PropIdRef, &r));
+                CHAKRA_SCRIPT_CALL(JsHasProperty(Parent, PropIdRef, &r));
                 return r;
             }
             bool Define(const RawValue& descriptor) const
             {
                 bool r;
-                CHAKRA_CALL(JsDefineProperty(Parent, PropIdRef, descriptor.Ref, &r));
+                CHAKRA_SCRIPT_CALL(JsDefineProperty(Parent, PropIdRef, descriptor.Ref, &r));
                 return r;
             }
-            RawValue Descriptor()
+            RawValue Descriptor() const
             {
                 RawValue r;
-                CHAKRA_CALL(JsGetOwnPropertyDescriptor(Parent, PropIdRef, &r.Ref));
+                CHAKRA_SCRIPT_CALL(JsGetOwnPropertyDescriptor(Parent, PropIdRef, &r.Ref));
                 return r;
             }
             [[maybe_unused]]RawValue Delete() const
             {
                 RawValue r;
-                CHAKRA_CALL(JsDeleteProperty(Parent, PropIdRef, true, &r.Ref));
+                CHAKRA_SCRIPT_CALL(JsDeleteProperty(Parent, PropIdRef, true, &r.Ref));
                 return r;
             }
         };
@@ -542,22 +594,32 @@ static RawValue methodName(const RawValue& message)         \
             operator RawValue() const
             {
                 RawValue r;
-                CHAKRA_CALL(JsGetIndexedProperty(Parent, PropIdRef, &r.Ref));
+                CHAKRA_SCRIPT_CALL(JsGetIndexedProperty(Parent, PropIdRef, &r.Ref));
                 return r;
             }
             const IndexedPropertyStub& operator =(const RawValue& value) const
             {
-                CHAKRA_CALL(JsSetIndexedProperty(Parent, PropIdRef, value.Ref));
+                CHAKRA_SCRIPT_CALL(JsSetIndexedProperty(Parent, PropIdRef, value.Ref));
                 return *this;
             }
             IndexedPropertyStub& operator =(const RawValue& value)
             {
-                CHAKRA_CALL(JsSetIndexedProperty(Parent, PropIdRef, value.Ref));
+                CHAKRA_SCRIPT_CALL(JsSetIndexedProperty(Parent, PropIdRef, value.Ref));
                 return *this;
             }
-            PropertyStub operator[](const wchar_t*const key) const
+            template<size_t Len>
+            PropertyStub operator[](const wchar_t(&key)[Len]) const
             {
-                return PropertyStub(RawValue(*this), key);
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(key));
+            }
+            template<typename TStr, typename = std::enable_if_t<is_wide_c_str_v<TStr>>>
+            PropertyStub operator[](const TStr& key) const
+            {
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(static_cast<const wchar_t*>(key)));
+            }
+            PropertyStub operator[](const RawPropertyKey key) const
+            {
+                return PropertyStub(RawValue(*this), RawPropertyIdTable::Lookup(key));
             }
             PropertyStub operator[](const RawPropertyId& key) const
             {
@@ -570,18 +632,28 @@ static RawValue methodName(const RawValue& message)         \
             [[nodiscard]] bool Exist() const
             {
                 bool r;
-                CHAKRA_CALL(JsHasIndexedProperty(Parent, PropIdRef, &r));
+                CHAKRA_SCRIPT_CALL(JsHasIndexedProperty(Parent, PropIdRef, &r));
                 return r;
             }
             void Delete() const
             {
-                CHAKRA_CALL(JsDeleteIndexedProperty(Parent, PropIdRef));
+                CHAKRA_SCRIPT_CALL(JsDeleteIndexedProperty(Parent, PropIdRef));
             }
         };
 
-        PropertyStub operator[](const wchar_t*const key) const
+        template<size_t Len>
+        PropertyStub operator[](const wchar_t(&key)[Len]) const
         {
-            return PropertyStub(*this, key);
+            return PropertyStub(*this, RawPropertyIdTable::Lookup(key));
+        }
+        template<typename TStr, typename = std::enable_if_t<is_wide_c_str_v<TStr>>>
+        PropertyStub operator[](const TStr& key) const
+        {
+            return PropertyStub(*this, RawPropertyIdTable::Lookup(static_cast<const wchar_t*>(key)));
+        }
+        PropertyStub operator[](const RawPropertyKey key) const
+        {
+            return PropertyStub(*this, RawPropertyIdTable::Lookup(key));
         }
         PropertyStub operator[](const RawPropertyId& key) const
         {
@@ -0,0 +1,138 @@
+﻿using Opportunity.ChakraBridge.WinRT;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using Windows.Storage;
+
+namespace Test
+{
+    /// <summary>
+    /// Microbenchmarks of the bridge, results are written to the debug output.
+    /// </summary>
+    /// <remarks>Define <c>BENCHMARK</c> to run them when the main page is shown, in release builds for meaningful numbers.</remarks>
+    internal static class Benchmarks
+    {
+        /// <summary>
+        /// Runs all benchmarks in a new runtime.
+        /// </summary>
+        public static void Run()
+        {
+            using (var runtime = JsRuntime.Create())
+            using (runtime.CreateContext().Use(true))
+            {
+                ObjectTemplate(10000, 16);
+                PrimitiveCalls(100000);
+                PropertyKeys(100000);
+                MapFile(1 << 20);
+            }
+        }
+
+        private static void Report(string name, int iterations, Action action)
+        {
+            // warm up, caches and helpers are filled by the first call.
+            action();
+            var watch = Stopwatch.StartNew();
+            for (var i = 0; i < iterations; i++)
+                action();
+            watch.Stop();
+            Debug.WriteLine($"{name}: {watch.Elapsed.TotalMilliseconds / iterations:F4} ms");
+        }
+
+        /// <summary>
+        /// Creates <paramref name="count"/> objects of <paramref name="keyCount"/> properties
+        /// with a template, and with one insert per property.
+        /// </summary>
+        public static void ObjectTemplate(int count, int keyCount)
+        {
+            var keys = new string[keyCount];
+            var values = new IJsValue[keyCount];
+            for (var i = 0; i < keyCount; i++)
+            {
+                keys[i] = "key" + i;
+                values[i] = JsNumber.Create(i);
+            }
+            var template = JsObject.CreateTemplate(keys);
+            Report($"Template.Instantiate x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                    template.Instantiate(values);
+            });
+            Report($"Object per property x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                {
+                    var obj = (IDictionary<string, IJsValue>)JsObject.Create();
+                    for (var i = 0; i < keyCount; i++)
+                        obj[keys[i]] = values[i];
+                }
+            });
+        }
+
+        /// <summary>
+        /// Calls a script function <paramref name="count"/> times with the global object as caller and primitive arguments,
+        /// and creates <paramref name="count"/> booleans.
+        /// </summary>
+        public static void PrimitiveCalls(int count)
+        {
+            var function = (IJsFunction)JsContext.RunScript("(function(a,b,c){return a;})");
+            var arguments = new IJsValue[] { JsUndefined.Instance, JsNull.Instance, JsBoolean.True };
+            Report($"Invoke with primitives x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                    function.Invoke(null, arguments);
+            });
+            Report($"JsBoolean.Create x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                    JsBoolean.Create((n & 1) == 0);
+            });
+        }
+
+        /// <summary>
+        /// Reads two properties of an object <paramref name="count"/> times through the same lookup by name,
+        /// <c>message</c> resolves to a pinned well-known key, <c>benchmark</c> resolves its property id on each call.
+        /// </summary>
+        public static void PropertyKeys(int count)
+        {
+            var obj = (IDictionary<string, IJsValue>)JsObject.Create();
+            var value = JsString.Create("benchmark");
+            obj["message"] = value;
+            obj["benchmark"] = value;
+            Report($"Well-known key x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                    _ = obj["message"];
+            });
+            Report($"Other key x{count}", 10, () =>
+            {
+                for (var n = 0; n < count; n++)
+                    _ = obj["benchmark"];
+            });
+        }
+
+        /// <summary>
+        /// Maps a file of <paramref name="length"/> bytes read only while it is still open for writing,
+        /// checks the mapped data and sums it from a typed array over the mapped buffer.
+        /// </summary>
+        public static void MapFile(int length)
+        {
+            var path = Path.Combine(ApplicationData.Current.TemporaryFolder.Path, "benchmark.bin");
+            var data = new byte[length];
+            for (var i = 0; i < length; i++)
+                data[i] = (byte)i;
+            using (var writer = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.ReadWrite))
+            {
+                writer.Write(data, 0, length);
+                writer.Flush();
+                var buffer = JsArrayBuffer.MapFile(path, 0, 0, true);
+                var array = (IList<byte>)JsTypedArray.Create(JsTypedArrayType.Uint8, buffer);
+                Debug.Assert(array.Count == length);
+                Debug.Assert(array[1] == 1 && array[length - 1] == data[length - 1]);
+                var sum = (IJsFunction)JsContext.RunScript("(function(a){var s=0;for(var i=0;i<a.length;i++)s+=a[i];return s;})");
+                Report($"Sum of mapped {length} bytes", 10, () => sum.Invoke(null, new IJsValue[] { (IJsValue)array }));
+            }
+            // the file is left in the temporary folder, it can not be deleted while the view is mapped.
+        }
+    }
+}
@@ -54,6 +54,9 @@ namespace Test
         protected async override void OnNavigatedTo(NavigationEventArgs e)
         {
             base.OnNavigatedTo(e);
+#if BENCHMARK
+            Benchmarks.Run();
+#endif
             try
             {
                 var js = new FileInfo(@"test.js");